@@ -0,0 +1,48 @@
+import {
+  buildAirportDataResource,
+  parseAirportDataResource,
+  readAirportDataHeader,
+  packIataCode,
+  unpackIataCode,
+  AIRPORT_DATA_HEADER_BYTES,
+  AIRPORT_DATA_VERSION,
+} from './airportDataResource';
+
+describe('airportDataResource', () => {
+  const data = {
+    buckets: [
+      { stdQuarters: -32, dstQuarters: -28, nameOffset: 0, nameCount: 2 },
+      { stdQuarters: 38, dstQuarters: 42, nameOffset: 2, nameCount: 1 },
+    ],
+    codes: ['LAX', 'SFO', 'ADL'],
+    names: ['Los Angeles', 'San Francisco', 'Adelaide Ñ'],
+  };
+
+  test('round-trips buckets, codes and names', () => {
+    const blob = buildAirportDataResource(data);
+    expect(parseAirportDataResource(blob)).toEqual(data);
+  });
+
+  test('writes a header describing every section', () => {
+    const blob = buildAirportDataResource(data);
+    const h = readAirportDataHeader(blob);
+    expect(blob.toString('ascii', 0, 4)).toBe('ATZD');
+    expect(h.version).toBe(AIRPORT_DATA_VERSION);
+    expect(h.bucketCount).toBe(2);
+    expect(h.codeCount).toBe(3);
+    expect(h.bucketsOffset).toBe(AIRPORT_DATA_HEADER_BYTES);
+    expect(h.nameMaxLen).toBe(Buffer.byteLength('San Francisco', 'utf8'));
+    expect(h.namesOffset + h.namesBytes).toBe(blob.length);
+  });
+
+  test('packs IATA codes into 15 bits', () => {
+    expect(packIataCode('AAA')).toBe(0);
+    expect(packIataCode('ZZZ')).toBe((25 << 10) | (25 << 5) | 25);
+    expect(unpackIataCode(packIataCode('SYD'))).toBe('SYD');
+    expect(() => packIataCode('L4X')).toThrow();
+  });
+
+  test('rejects mismatched code and name lists', () => {
+    expect(() => buildAirportDataResource({ ...data, names: ['Only one'] })).toThrow();
+  });
+});
@@ -0,0 +1,149 @@
+// Binary airport data resource, read on the watch with resource_load_byte_range()
+//
+// Layout (all integers little-endian), mirrored by AirportDataHeader in
+// src/c/clock_closest_airport_noon.h:
+//
+//   header   32 bytes   magic "ATZD", version, counts and section offsets
+//   buckets  5 bytes    per bucket: std_quarters, dst_quarters (int8),
+//                       name_offset (uint16), name_count (uint8)
+//   codes    2 bytes    per airport: IATA code packed 5 bits per letter
+//   index    4 bytes    per airport plus one: byte offset of each name
+//   names    UTF-8 names back to back, no terminators
+//
+// Only the bucket table is loaded into RAM; a code and a name are fetched by
+// offset when an airport is picked.
+
+export const AIRPORT_DATA_MAGIC = 'ATZD';
+export const AIRPORT_DATA_VERSION = 1;
+export const AIRPORT_DATA_HEADER_BYTES = 32;
+export const AIRPORT_DATA_BUCKET_BYTES = 5;
+
+export interface AirportDataBucket {
+  stdQuarters: number;
+  dstQuarters: number;
+  nameOffset: number;
+  nameCount: number;
+}
+
+export interface AirportData {
+  buckets: AirportDataBucket[];
+  codes: string[];
+  names: string[];
+}
+
+export interface AirportDataHeader {
+  version: number;
+  bucketCount: number;
+  codeCount: number;
+  nameMaxLen: number;
+  bucketsOffset: number;
+  codesOffset: number;
+  nameIndexOffset: number;
+  namesOffset: number;
+  namesBytes: number;
+}
+
+// Packs a 3-letter IATA code into 15 bits, A-Z as 0-25
+export function packIataCode(code: string): number {
+  const letter = (i: number): number => {
+    const v = code.charCodeAt(i) - 65;
+    if (v < 0 || v > 25) throw new Error(`Cannot pack IATA code ${code}`);
+    return v;
+  };
+  return (letter(0) << 10) | (letter(1) << 5) | letter(2);
+}
+
+export function unpackIataCode(bits: number): string {
+  return String.fromCharCode(65 + ((bits >> 10) & 0x1f), 65 + ((bits >> 5) & 0x1f), 65 + (bits & 0x1f));
+}
+
+export function buildAirportDataResource(data: AirportData): Buffer {
+  if (data.codes.length !== data.names.length) {
+    throw new Error(`Code/name count mismatch: ${data.codes.length} vs ${data.names.length}`);
+  }
+  if (data.buckets.length > 0xff || data.codes.length > 0xffff) {
+    throw new Error(`Too many entries for the resource format: ${data.buckets.length} buckets, ${data.codes.length} codes`);
+  }
+  const encoded = data.names.map(n => Buffer.from(n, 'utf8'));
+  const namesBytes = encoded.reduce((sum, b) => sum + b.length, 0);
+  const nameMaxLen = encoded.reduce((max, b) => Math.max(max, b.length), 0);
+
+  const bucketsOffset = AIRPORT_DATA_HEADER_BYTES;
+  const codesOffset = bucketsOffset + data.buckets.length * AIRPORT_DATA_BUCKET_BYTES;
+  const nameIndexOffset = codesOffset + data.codes.length * 2;
+  const namesOffset = nameIndexOffset + (data.names.length + 1) * 4;
+  const buf = Buffer.alloc(namesOffset + namesBytes);
+
+  buf.write(AIRPORT_DATA_MAGIC, 0, 'ascii');
+  buf.writeUInt16LE(AIRPORT_DATA_VERSION, 4);
+  buf.writeUInt16LE(data.buckets.length, 6);
+  buf.writeUInt16LE(data.codes.length, 8);
+  buf.writeUInt16LE(nameMaxLen, 10);
+  buf.writeUInt32LE(bucketsOffset, 12);
+  buf.writeUInt32LE(codesOffset, 16);
+  buf.writeUInt32LE(nameIndexOffset, 20);
+  buf.writeUInt32LE(namesOffset, 24);
+  buf.writeUInt32LE(namesBytes, 28);
+
+  data.buckets.forEach((b, i) => {
+    const at = bucketsOffset + i * AIRPORT_DATA_BUCKET_BYTES;
+    buf.writeInt8(b.stdQuarters, at);
+    buf.writeInt8(b.dstQuarters, at + 1);
+    buf.writeUInt16LE(b.nameOffset, at + 2);
+    buf.writeUInt8(b.nameCount, at + 4);
+  });
+  data.codes.forEach((code, i) => buf.writeUInt16LE(packIataCode(code), codesOffset + i * 2));
+
+  let pos = 0;
+  encoded.forEach((name, i) => {
+    buf.writeUInt32LE(pos, nameIndexOffset + i * 4);
+    name.copy(buf, namesOffset + pos);
+    pos += name.length;
+  });
+  buf.writeUInt32LE(pos, nameIndexOffset + encoded.length * 4);
+  return buf;
+}
+
+export function readAirportDataHeader(buf: Buffer): AirportDataHeader {
+  if (buf.length < AIRPORT_DATA_HEADER_BYTES || buf.toString('ascii', 0, 4) !== AIRPORT_DATA_MAGIC) {
+    throw new Error('Not an airport data resource');
+  }
+  return {
+    version: buf.readUInt16LE(4),
+    bucketCount: buf.readUInt16LE(6),
+    codeCount: buf.readUInt16LE(8),
+    nameMaxLen: buf.readUInt16LE(10),
+    bucketsOffset: buf.readUInt32LE(12),
+    codesOffset: buf.readUInt32LE(16),
+    nameIndexOffset: buf.readUInt32LE(20),
+    namesOffset: buf.readUInt32LE(24),
+    namesBytes: buf.readUInt32LE(28),
+  };
+}
+
+// Reference reader, doing the same ranged reads as the watch
+export function parseAirportDataResource(buf: Buffer): AirportData {
+  const h = readAirportDataHeader(buf);
+  if (h.version !== AIRPORT_DATA_VERSION) {
+    throw new Error(`Unsupported airport data version ${h.version}`);
+  }
+  const buckets: AirportDataBucket[] = [];
+  for (let i = 0; i < h.bucketCount; i++) {
+    const at = h.bucketsOffset + i * AIRPORT_DATA_BUCKET_BYTES;
+    buckets.push({
+      stdQuarters: buf.readInt8(at),
+      dstQuarters: buf.readInt8(at + 1),
+      nameOffset: buf.readUInt16LE(at + 2),
+      nameCount: buf.readUInt8(at + 4),
+    });
+  }
+  const codes: string[] = [];
+  const names: string[] = [];
+  for (let i = 0; i < h.codeCount; i++) {
+    codes.push(unpackIataCode(buf.readUInt16LE(h.codesOffset + i * 2)));
+    const start = buf.readUInt32LE(h.nameIndexOffset + i * 4);
+    const end = buf.readUInt32LE(h.nameIndexOffset + (i + 1) * 4);
+    names.push(buf.toString('utf8', h.namesOffset + start, h.namesOffset + end));
+  }
+  return { buckets, codes, names };
+}
@@ -0,0 +1,55 @@
+import path from 'path';
+import { formatDataTiers, formatFootprints, parseDataTiers, tierOutputPaths } from './dataTiers';
+
+describe('dataTiers', () => {
+  const config = parseDataTiers(JSON.stringify({
+    default: 'full',
+    tiers: [
+      { name: 'full', groupSize: 10, maxBucket: 10, platforms: ['basalt', 'diorite'] },
+      { name: 'compact', groupSize: 5, maxBucket: 3, platforms: ['aplite'] },
+    ],
+  }));
+
+  test('keeps the plain file names for the default tier', () => {
+    const outputs = tierOutputPaths(config.tiers[0], config, path.join('c', 'airport_tz_list.c'),
+                                    path.join('data', 'airport_data.bin'));
+    expect(outputs).toEqual({ out: path.join('c', 'airport_tz_list.c'), resources: [path.join('data', 'airport_data.bin')] });
+  });
+
+  test('suffixes the C file and tags the resource per platform for other tiers', () => {
+    const outputs = tierOutputPaths(config.tiers[1], config, path.join('c', 'airport_tz_list.c'),
+                                    path.join('data', 'airport_data.bin'));
+    expect(outputs.out).toBe(path.join('c', 'airport_tz_list_compact.c'));
+    expect(outputs.resources).toEqual([path.join('data', 'airport_data~aplite.bin')]);
+    expect(tierOutputPaths(config.tiers[1], config, 'airport_tz_list.c', null).resources).toEqual([]);
+  });
+
+  test('rejects a platform in two tiers and an unknown default', () => {
+    const tiers = [
+      { name: 'a', groupSize: 1, maxBucket: 1, platforms: ['aplite'] },
+      { name: 'b', groupSize: 1, maxBucket: 1, platforms: ['aplite'] },
+    ];
+    expect(() => parseDataTiers(JSON.stringify({ default: 'a', tiers }))).toThrow(/two tiers/);
+    expect(() => parseDataTiers(JSON.stringify({ default: 'c', tiers: tiers.slice(0, 1) }))).toThrow(/default/);
+  });
+
+  test('formats one aligned row per tier', () => {
+    const table = formatFootprints([
+      { tier: 'full', buckets: 60, codes: 371, events: 421, flashBytes: 1780, resourceBytes: 8111, ramBytes: 540 },
+      { tier: 'compact', buckets: 58, codes: 120, events: 400, flashBytes: 1700, resourceBytes: 2900, ramBytes: 522 },
+    ]).split('\n');
+    expect(table).toHaveLength(3);
+    expect(table[1]).toMatch(/^full\s+60\s+371\s+421\s+1780 B\s+8111 B\s+540 B$/);
+    expect(new Set(table.map(l => l.length)).size).toBe(1);
+  });
+
+  test('round-trips the file layout and checks the budget', () => {
+    const text = '{\n  "default": "full",\n  "tiers": [\n' +
+      '    { "name": "full", "groupSize": 10, "maxBucket": 10, "platforms": ["basalt", "diorite"] },\n' +
+      '    { "name": "compact", "groupSize": 5, "maxBucket": 3, "platforms": ["aplite"], "budgetBytes": 4096 }\n' +
+      '  ]\n}\n';
+    expect(formatDataTiers(parseDataTiers(text))).toBe(text);
+    const tiers = [{ name: 'a', groupSize: 1, maxBucket: 1, platforms: [], budgetBytes: 0 }];
+    expect(() => parseDataTiers(JSON.stringify({ default: 'a', tiers }))).toThrow(/budgetBytes/);
+  });
+});
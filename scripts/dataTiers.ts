@@ -0,0 +1,115 @@
+import * as fs from 'fs/promises';
+import * as path from 'path';
+
+// ---------------------------------------------------------------------------
+// Per-platform data tiers
+//
+// dataTiers.json lists the variants generateAirportTzList.ts writes in one
+// run, each with its own groupSize/maxBucket and the platforms it serves.
+// The default tier keeps the plain file names (airport_tz_list.c,
+// airport_data.bin), which the host simulation and any unlisted platform use;
+// every other tier gets airport_tz_list_<tier>.c plus one platform-tagged
+// resource (airport_data~<platform>.bin) per platform.  wscript reads the
+// same file to point each platform's build at its C variant, and the SDK
+// picks the tagged resource by itself.  A tier with a budgetBytes can have
+// its groupSize/maxBucket chosen by --optimize (see tableOptimizer.ts), which
+// writes the result back here.
+// ---------------------------------------------------------------------------
+
+export interface DataTier {
+    name: string;
+    groupSize: number;
+    maxBucket: number;
+    platforms: string[];
+    budgetBytes?: number;   // code pool, name pool and bucket table, for --optimize
+}
+
+export interface DataTierConfig {
+    default: string;
+    tiers: DataTier[];
+}
+
+export interface TierOutputs {
+    out: string;          // C file
+    resources: string[];  // resource copies, empty when embedding
+}
+
+/** Data cost of one generated variant, in bytes */
+export interface DataFootprint {
+    tier: string;
+    buckets: number;
+    codes: number;
+    events: number;
+    flashBytes: number;     // tables compiled into the app binary
+    resourceBytes: number;  // airport data resource, 0 when embedded
+    ramBytes: number;       // bucket table and per-bucket state on the watch
+}
+
+export function parseDataTiers(text: string): DataTierConfig {
+    const config = JSON.parse(text) as DataTierConfig;
+    if (!Array.isArray(config.tiers) || config.tiers.length === 0) {
+        throw new Error('Data tiers: no tiers listed');
+    }
+    const names = new Set<string>();
+    const platforms = new Set<string>();
+    for (const tier of config.tiers) {
+        if (!/^[a-z0-9_]+$/.test(tier.name ?? '')) throw new Error(`Data tiers: invalid tier name ${tier.name}`);
+        if (names.has(tier.name)) throw new Error(`Data tiers: duplicate tier ${tier.name}`);
+        names.add(tier.name);
+        if (!Number.isInteger(tier.groupSize) || !Number.isInteger(tier.maxBucket)) {
+            throw new Error(`Data tiers: ${tier.name} needs integer groupSize and maxBucket`);
+        }
+        if (tier.budgetBytes !== undefined && !(Number.isInteger(tier.budgetBytes) && tier.budgetBytes > 0)) {
+            throw new Error(`Data tiers: ${tier.name} needs a positive integer budgetBytes`);
+        }
+        for (const platform of tier.platforms ?? []) {
+            if (platforms.has(platform)) throw new Error(`Data tiers: ${platform} is listed in two tiers`);
+            platforms.add(platform);
+        }
+        tier.platforms = tier.platforms ?? [];
+    }
+    if (!names.has(config.default)) throw new Error(`Data tiers: default tier ${config.default} is not listed`);
+    return config;
+}
+
+export async function loadDataTiers(file: string): Promise<DataTierConfig> {
+    return parseDataTiers(await fs.readFile(file, 'utf-8'));
+}
+
+/** The file as it is kept in the repo: one line per tier */
+export function formatDataTiers(config: DataTierConfig): string {
+    const value = (v: unknown): string =>
+        Array.isArray(v) ? `[${v.map(x => JSON.stringify(x)).join(', ')}]` : JSON.stringify(v);
+    const tiers = config.tiers.map(tier =>
+        `    { ${Object.entries(tier).map(([k, v]) => `${JSON.stringify(k)}: ${value(v)}`).join(', ')} }`);
+    return `{\n  "default": ${JSON.stringify(config.default)},\n  "tiers": [\n${tiers.join(',\n')}\n  ]\n}\n`;
+}
+
+export async function saveDataTiers(file: string, config: DataTierConfig): Promise<void> {
+    await fs.writeFile(file, formatDataTiers(config), 'utf-8');
+}
+
+/** Where a tier's variant goes, given the default tier's output paths */
+export function tierOutputPaths(tier: DataTier, config: DataTierConfig, outPath: string,
+                                resourcePath: string | null): TierOutputs {
+    if (tier.name === config.default) {
+        return { out: outPath, resources: resourcePath ? [resourcePath] : [] };
+    }
+    const out = path.join(path.dirname(outPath),
+                          `${path.basename(outPath, path.extname(outPath))}_${tier.name}${path.extname(outPath)}`);
+    if (!resourcePath) return { out, resources: [] };
+    const ext = path.extname(resourcePath);
+    const base = resourcePath.slice(0, resourcePath.length - ext.length);
+    return { out, resources: tier.platforms.map(p => `${base}~${p}${ext}`) };
+}
+
+export function formatFootprints(footprints: DataFootprint[]): string {
+    const rows = [['tier', 'buckets', 'airports', 'events', 'flash', 'resource', 'RAM']];
+    for (const f of footprints) {
+        rows.push([f.tier, String(f.buckets), String(f.codes), String(f.events),
+                   `${f.flashBytes} B`, `${f.resourceBytes} B`, `${f.ramBytes} B`]);
+    }
+    const widths = rows[0].map((_, c) => Math.max(...rows.map(r => r[c].length)));
+    return rows.map(r => r.map((cell, c) => c === 0 ? cell.padEnd(widths[c]) : cell.padStart(widths[c])).join('  '))
+               .join('\n');
+}
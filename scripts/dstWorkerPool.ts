@@ -0,0 +1,105 @@
+import * as os from 'os';
+import { Worker, isMainThread, parentPort } from 'worker_threads';
+import { findDstTransitions, dstTransitionStats, DstTransitions } from './tzCommon';
+
+// ---------------------------------------------------------------------------
+// DST transitions on a worker pool
+//
+// findDstTransitions() is pure per zone, so the generator computes every
+// zone it needs up front, one zone (all table years) per job, and the bucket
+// loop then only reads the memo table.  Each worker keeps its own offset
+// timelines, which is why a zone never spans two jobs.  Results are filled in
+// under the generator's memo keys; a zone that throws is recorded as null,
+// exactly as memoizedFindDstTransitions() would.
+// ---------------------------------------------------------------------------
+
+interface DstJob {
+    zone: string;
+    years: number[];
+}
+
+interface DstJobResult {
+    zone: string;
+    results: Array<DstTransitions | null>;
+    fast: number;
+    walked: number;
+}
+
+function runJob(job: DstJob): DstJobResult {
+    const before = dstTransitionStats();
+    const results = job.years.map(year => {
+        try {
+            return findDstTransitions(job.zone, year);
+        } catch {
+            return null;
+        }
+    });
+    const after = dstTransitionStats();
+    return { zone: job.zone, results, fast: after.fast - before.fast, walked: after.walked - before.walked };
+}
+
+/** Start a worker on this file, from plain JS (bun, compiled) or through ts-node */
+function startWorker(): Worker {
+    if (process.versions.bun || __filename.endsWith('.js')) return new Worker(__filename);
+    const bootstrap = `process.env.TS_NODE_TRANSPILE_ONLY = 'true';\n` +
+                      `require('ts-node/register');\n` +
+                      `require(${JSON.stringify(__filename)});\n`;
+    return new Worker(bootstrap, { eval: true });
+}
+
+/**
+ * Compute the transitions of every zone/year missing from `cache` (keyed
+ * `${zone}_${year}`) on `workers` threads; 0 picks one per CPU, 1 or a
+ * handful of zones runs inline.
+ */
+export async function precomputeDstTransitions(zones: Iterable<string>, years: number[],
+                                               cache: Map<string, DstTransitions | null>,
+                                               workers: number = 0): Promise<void> {
+    const jobs: DstJob[] = [];
+    for (const zone of new Set(zones)) {
+        if (!zone) continue;
+        const missing = years.filter(year => !cache.has(`${zone}_${year}`));
+        if (missing.length) jobs.push({ zone, years: missing });
+    }
+    if (!jobs.length) return;
+
+    const started = Date.now();
+    const poolSize = Math.min(workers > 0 ? workers : os.cpus().length, Math.ceil(jobs.length / 4));
+    let fast = 0;
+    let walked = 0;
+    const store = (done: DstJobResult, years: number[]) => {
+        done.results.forEach((result, i) => cache.set(`${done.zone}_${years[i]}`, result));
+        fast += done.fast;
+        walked += done.walked;
+    };
+
+    if (poolSize <= 1) {
+        for (const job of jobs) store(runJob(job), job.years);
+    } else {
+        const byZone = new Map(jobs.map(job => [job.zone, job]));
+        let next = 0;
+        await Promise.all(Array.from({ length: poolSize }, () => new Promise<void>((resolve, reject) => {
+            const worker = startWorker();
+            const feed = () => {
+                if (next < jobs.length) {
+                    worker.postMessage(jobs[next++]);
+                } else {
+                    worker.terminate().then(() => resolve(), reject);
+                }
+            };
+            worker.on('message', (done: DstJobResult) => {
+                store(done, byZone.get(done.zone)!.years);
+                feed();
+            });
+            worker.on('error', reject);
+            feed();
+        })));
+    }
+    console.log(`DST transitions: ${jobs.length} zones on ${Math.max(poolSize, 1)} thread(s) in ${Date.now() - started} ms ` +
+                `(${fast} zone-years from offset timelines, ${walked} walked with Luxon)`);
+}
+
+if (!isMainThread && parentPort) {
+    const port = parentPort;
+    port.on('message', (job: DstJob) => port.postMessage(runJob(job)));
+}
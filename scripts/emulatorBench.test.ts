@@ -0,0 +1,82 @@
+import {
+  type BenchReport, type ProfileSummary, SCENARIOS, configPushScript, formatBenchComparison, formatBenchReport,
+  nthSundayUtc, parseProfileLine, summarizeWindows,
+} from './emulatorBench';
+
+describe('emulatorBench', () => {
+  const day = (seconds: number) => new Date(seconds * 1000).toISOString().slice(0, 10);
+
+  const window = (overrides: Partial<ProfileSummary> = {}): ProfileSummary => ({
+    version: 3, windowMinutes: 1, ticks: 60, tickTotalMs: 120, tickMaxMs: 9, reevalCount: 0, reevalMaxMs: 0,
+    frames: 60, heapFreeMin: 9000, heapFreeMax: 9400, heapUsedMax: 14000, messageHeap: 420,
+    redraws: { time: 60, tid: 60 }, ...overrides,
+  });
+
+  test('finds the DST Sundays', () => {
+    expect(day(nthSundayUtc(2025, 3, -1))).toBe('2025-03-30');
+    expect(day(nthSundayUtc(2025, 10, -1))).toBe('2025-10-26');
+    expect(day(nthSundayUtc(2025, 3, 2))).toBe('2025-03-09');
+    expect(day(nthSundayUtc(2025, 11, 1))).toBe('2025-11-02');
+    expect(day(nthSundayUtc(2026, 3, -1))).toBe('2026-03-29');
+  });
+
+  test('starts the re-evaluation scenarios just before their slot', () => {
+    for (const minute of [0, 15, 30]) {
+      const scenario = SCENARIOS.find(s => s.name === `reeval-${String(minute).padStart(2, '0')}`)!;
+      const start = new Date(scenario.start(2025) * 1000);
+      expect((start.getUTCMinutes() + 1) % 60).toBe(minute);
+      expect(start.getUTCSeconds()).toBe(30);
+      expect(scenario.seconds).toBeGreaterThan(30);
+    }
+    for (const s of SCENARIOS) expect(s.actions.every(a => a.at < s.seconds)).toBe(true);
+  });
+
+  test('reads summaries off the log lines', () => {
+    const line = `[12:05:01] javascript> tidface profile ${JSON.stringify(window())}`;
+    expect(parseProfileLine(line)).toMatchObject({ ticks: 60, heapUsedMax: 14000 });
+    expect(parseProfileLine('[12:05:01] javascript> tidface profile: unknown summary version 2')).toBeNull();
+    expect(parseProfileLine('tidface profile {broken')).toBeNull();
+  });
+
+  test('folds windows into rates per hour', () => {
+    const metrics = summarizeWindows([
+      window(),
+      window({ windowMinutes: 2, ticks: 61, tickTotalMs: 300, tickMaxMs: 40, reevalCount: 1, reevalMaxMs: 35,
+               heapFreeMin: 8800, heapUsedMax: 14200, redraws: { code: 1, time: 61 } }),
+    ])!;
+    expect(metrics.minutes).toBe(3);
+    expect(metrics.wakeupsPerHour).toBeCloseTo(121 * 20);
+    expect(metrics.tickMsPerHour).toBeCloseTo(420 * 20);
+    expect(metrics.tickAvgMs).toBeCloseTo(420 / 121);
+    expect(metrics).toMatchObject({ tickMaxMs: 40, reevals: 1, reevalMaxMs: 35, heapPeakBytes: 14200,
+                                    heapFreeLowBytes: 8800 });
+    expect(metrics.redrawsPerHour).toEqual({ time: 121 * 20, tid: 60 * 20, code: 20 });
+    expect(summarizeWindows([])).toBeNull();
+  });
+
+  test('writes a config push for the repl', () => {
+    const script = configPushScript('d3486974-f487-4d30-b67f-9143c3ce7ab3', { colorScheme: 10001, worldStrip: 10002 },
+                                    { colorScheme: '1', worldStrip: 1 });
+    expect(script).toContain("uuid.UUID('d3486974-f487-4d30-b67f-9143c3ce7ab3'), {10001: CString(\"1\"), 10002: Int32(1)}");
+    expect(() => configPushScript('x', {}, { glanceSeconds: '20' })).toThrow(/glanceSeconds/);
+  });
+
+  test('reports and compares builds', () => {
+    const report = (build: string, ticks: number): BenchReport => ({
+      build, date: '2025-06-02T12:00:00.000Z', year: 2025,
+      results: [
+        { platform: 'basalt', scenario: 'steady', metrics: summarizeWindows([window({ ticks })]), errors: [] },
+        { platform: 'aplite', scenario: 'steady', metrics: null, errors: ['no profile summary arrived'] },
+      ],
+    });
+    const text = formatBenchReport(report('v1.1.0', 60)).split('\n');
+    expect(text[0]).toBe('Emulator bench for v1.1.0 (2025-06-02T12:00:00.000Z, scenarios in 2025)');
+    expect(text[2]).toMatch(/^basalt\s+steady\s+1\s+3600\.0\s/);
+    expect(text[text.length - 1]).toBe('aplite steady: no profile summary arrived');
+
+    const comparison = formatBenchComparison(report('v1.1.0', 60), report('v1.2.0', 30)).split('\n');
+    expect(comparison[0]).toBe('v1.2.0 against v1.1.0');
+    expect(comparison).toHaveLength(3);
+    expect(comparison[2]).toContain('1800.0 (-50.0%)');
+  });
+});
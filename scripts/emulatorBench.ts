@@ -0,0 +1,373 @@
+import { spawn, spawnSync } from 'child_process';
+import { program } from 'commander';
+import * as fs from 'fs/promises';
+import * as path from 'path';
+
+// ---------------------------------------------------------------------------
+// Emulator scenario benchmark (`./r bench`)
+//
+// Installs a profiler build (TIDFACE_PROFILER, see src/c/profiler.h) on each
+// emulator platform and drives it through scripted scenarios: DST boundary
+// days, the :00/:15/:30 re-evaluation seconds, config pushes and app switches.
+// Every scenario sets the emulator clock, launches the face and collects the
+// `tidface profile {...}` lines src/pkjs/index.js logs for each summary
+// window.  The windows are folded into rates per hour, so a window lost to a
+// relaunch does not skew them, and written as one report per build
+// (bench/<git describe>.json and .txt) for comparing commits before a release.
+// ---------------------------------------------------------------------------
+
+/**
+ * What the face goes through in a scenario, `at` seconds after its launch:
+ * a wrist tap, a settings push (values typed as Clay sends them), a trip to
+ * the launcher and back (warm start) or a reinstall (cold start)
+ */
+export type BenchAction =
+    | { kind: 'tap' }
+    | { kind: 'config'; values: Record<string, string | number> }
+    | { kind: 'warm' }
+    | { kind: 'cold' };
+
+export interface BenchScenario {
+    name: string;
+    description: string;
+    start: (year: number) => number;   // UTC seconds the emulator clock is set to
+    seconds: number;                   // how long the face runs
+    actions: Array<{ at: number; action: BenchAction }>;
+}
+
+/** A decoded ProfileSummary, as logged by decodeProfile() in src/pkjs/index.js */
+export interface ProfileSummary {
+    version: number;
+    windowMinutes: number;
+    ticks: number;
+    tickTotalMs: number;
+    tickMaxMs: number;
+    reevalCount: number;
+    reevalMaxMs: number;
+    frames: number;
+    heapFreeMin: number;
+    heapFreeMax: number;
+    heapUsedMax: number;
+    messageHeap: number;
+    redraws: Record<string, number>;
+}
+
+export interface BenchMetrics {
+    windows: number;
+    minutes: number;
+    wakeupsPerHour: number;
+    tickMsPerHour: number;     // time spent in tick_handler
+    tickAvgMs: number;
+    tickMaxMs: number;
+    reevals: number;
+    reevalMaxMs: number;
+    framesPerHour: number;
+    redrawsPerHour: Record<string, number>;
+    heapPeakBytes: number;     // heap_bytes_used() high water mark
+    heapFreeLowBytes: number;
+    messageHeapBytes: number;
+}
+
+export interface BenchResult {
+    platform: string;
+    scenario: string;
+    metrics: BenchMetrics | null;  // null if no summary arrived
+    errors: string[];
+}
+
+export interface BenchReport {
+    build: string;        // git describe --always --dirty
+    date: string;
+    year: number;
+    results: BenchResult[];
+}
+
+export const BENCH_PLATFORMS = ['basalt', 'aplite'];
+
+// --- Scenarios ---
+
+const HOUR = 3600;
+
+/** UTC midnight of the n-th Sunday of `month` (1-12); n = -1 is the last one */
+export function nthSundayUtc(year: number, month: number, n: number): number {
+    if (n < 0) {
+        const last = new Date(Date.UTC(year, month, 0));
+        return Date.UTC(year, month - 1, last.getUTCDate() - last.getUTCDay()) / 1000;
+    }
+    const first = new Date(Date.UTC(year, month - 1, 1)).getUTCDay();
+    return Date.UTC(year, month - 1, 1 + (7 - first) % 7 + (n - 1) * 7) / 1000;
+}
+
+// A quiet mid-slot minute, away from re-evaluations and DST changes
+const midSlot = (year: number) => Date.UTC(year, 5, 2, 12, 5) / 1000;
+
+const beforeSlot = (minute: number) => (year: number) => Date.UTC(year, 5, 2, 12, minute) / 1000 - 30;
+
+const dstDay = (name: string, description: string, instant: (year: number) => number): BenchScenario =>
+    ({ name, description, start: year => instant(year) - 90, seconds: 240, actions: [] });
+
+const DEFAULT_CONFIG = { colorScheme: '0', worldStrip: 0, glanceSeconds: '0' };
+
+export const SCENARIOS: BenchScenario[] = [
+    { name: 'steady', description: 'full face mid-slot, nothing happening', start: midSlot, seconds: 300, actions: [] },
+    dstDay('dst-eu-spring', 'EU clocks go forward (01:00 UTC, last Sunday of March)',
+           year => nthSundayUtc(year, 3, -1) + 1 * HOUR),
+    dstDay('dst-eu-autumn', 'EU clocks go back (01:00 UTC, last Sunday of October)',
+           year => nthSundayUtc(year, 10, -1) + 1 * HOUR),
+    dstDay('dst-us-spring', 'US Eastern goes forward (07:00 UTC, second Sunday of March)',
+           year => nthSundayUtc(year, 3, 2) + 7 * HOUR),
+    dstDay('dst-us-autumn', 'US Eastern goes back (06:00 UTC, first Sunday of November)',
+           year => nthSundayUtc(year, 11, 1) + 6 * HOUR),
+    ...[0, 15, 30].map(minute => ({
+        name: `reeval-${String(minute).padStart(2, '0')}`,
+        description: `over the :${String(minute).padStart(2, '0')} re-evaluation`,
+        start: beforeSlot(minute), seconds: 180, actions: [],
+    })),
+    {
+        name: 'config', description: 'dark scheme, world strip, then glance mode with taps', start: midSlot, seconds: 300,
+        actions: [
+            { at: 30, action: { kind: 'config', values: { colorScheme: '1' } } },
+            { at: 60, action: { kind: 'config', values: { worldStrip: 1 } } },
+            { at: 90, action: { kind: 'config', values: { glanceSeconds: '20' } } },
+            { at: 150, action: { kind: 'tap' } },
+            { at: 210, action: { kind: 'tap' } },
+            { at: 270, action: { kind: 'config', values: DEFAULT_CONFIG } },
+        ],
+    },
+    {
+        name: 'app-switch', description: 'launcher and back (warm start), then a reinstall (cold start)',
+        start: midSlot, seconds: 240,
+        actions: [
+            { at: 60, action: { kind: 'warm' } },
+            { at: 150, action: { kind: 'cold' } },
+        ],
+    },
+];
+
+// --- Summaries and metrics ---
+
+const PROFILE_LINE = /tidface profile (\{.*\})\s*$/;
+
+/** The summary on a `rebble logs` line, or null */
+export function parseProfileLine(line: string): ProfileSummary | null {
+    const match = PROFILE_LINE.exec(line);
+    if (!match) return null;
+    try {
+        const summary = JSON.parse(match[1]) as ProfileSummary;
+        return summary.windowMinutes > 0 ? summary : null;
+    } catch {
+        return null;
+    }
+}
+
+export function summarizeWindows(summaries: ProfileSummary[]): BenchMetrics | null {
+    const minutes = summaries.reduce((sum, s) => sum + s.windowMinutes, 0);
+    if (minutes === 0) return null;
+    const perHour = (value: number) => value * 60 / minutes;
+    const sum = (pick: (s: ProfileSummary) => number) => summaries.reduce((total, s) => total + pick(s), 0);
+    const max = (pick: (s: ProfileSummary) => number) => Math.max(...summaries.map(pick));
+
+    const redraws: Record<string, number> = {};
+    for (const s of summaries) {
+        for (const [field, count] of Object.entries(s.redraws)) redraws[field] = (redraws[field] ?? 0) + count;
+    }
+    const ticks = sum(s => s.ticks);
+    return {
+        windows: summaries.length,
+        minutes,
+        wakeupsPerHour: perHour(ticks),
+        tickMsPerHour: perHour(sum(s => s.tickTotalMs)),
+        tickAvgMs: ticks ? sum(s => s.tickTotalMs) / ticks : 0,
+        tickMaxMs: max(s => s.tickMaxMs),
+        reevals: sum(s => s.reevalCount),
+        reevalMaxMs: max(s => s.reevalMaxMs),
+        framesPerHour: perHour(sum(s => s.frames)),
+        redrawsPerHour: Object.fromEntries(Object.entries(redraws).map(([field, count]) => [field, perHour(count)])),
+        heapPeakBytes: max(s => s.heapUsedMax),
+        heapFreeLowBytes: Math.min(...summaries.map(s => s.heapFreeMin)),
+        messageHeapBytes: summaries[summaries.length - 1].messageHeap,
+    };
+}
+
+// --- Report ---
+
+function formatRows(rows: string[][]): string[] {
+    const widths = rows[0].map((_, col) => Math.max(...rows.map(r => r[col].length)));
+    return rows.map(r => r.map((cell, col) => col < 2 ? cell.padEnd(widths[col]) : cell.padStart(widths[col]))
+                          .join('  ').trimEnd());
+}
+
+const totalRedraws = (m: BenchMetrics) => Object.values(m.redrawsPerHour).reduce((a, b) => a + b, 0);
+
+export function formatBenchReport(report: BenchReport): string {
+    const rows = [['platform', 'scenario', 'min', 'wake/h', 'tick ms/h', 'avg ms', 'max ms', 'reevals',
+                   'frames/h', 'redraws/h', 'heap peak']];
+    const notes: string[] = [];
+    for (const r of report.results) {
+        const m = r.metrics;
+        rows.push(m
+            ? [r.platform, r.scenario, String(m.minutes), m.wakeupsPerHour.toFixed(1), m.tickMsPerHour.toFixed(0),
+               m.tickAvgMs.toFixed(2), String(m.tickMaxMs), `${m.reevals} (${m.reevalMaxMs} ms)`,
+               m.framesPerHour.toFixed(0), totalRedraws(m).toFixed(0), `${m.heapPeakBytes} B`]
+            : [r.platform, r.scenario, '-', '-', '-', '-', '-', '-', '-', '-', '-']);
+        for (const error of r.errors) notes.push(`${r.platform} ${r.scenario}: ${error}`);
+    }
+    return [`Emulator bench for ${report.build} (${report.date}, scenarios in ${report.year})`, ...formatRows(rows),
+            ...notes].join('\n');
+}
+
+/** The headline metrics of `head` against `base`, for the scenarios both ran */
+export function formatBenchComparison(base: BenchReport, head: BenchReport): string {
+    const change = (from: number, to: number, digits: number) => {
+        if (from === 0) return `${to.toFixed(digits)} (${to === 0 ? '=' : 'new'})`;
+        const percent = (to - from) / from * 100;
+        return `${to.toFixed(digits)} (${percent >= 0 ? '+' : ''}${percent.toFixed(1)}%)`;
+    };
+    const rows = [['platform', 'scenario', 'wake/h', 'tick ms/h', 'frames/h', 'redraws/h', 'heap peak']];
+    for (const r of head.results) {
+        const b = base.results.find(x => x.platform === r.platform && x.scenario === r.scenario);
+        if (!b?.metrics || !r.metrics) continue;
+        rows.push([r.platform, r.scenario,
+                   change(b.metrics.wakeupsPerHour, r.metrics.wakeupsPerHour, 1),
+                   change(b.metrics.tickMsPerHour, r.metrics.tickMsPerHour, 0),
+                   change(b.metrics.framesPerHour, r.metrics.framesPerHour, 0),
+                   change(totalRedraws(b.metrics), totalRedraws(r.metrics), 0),
+                   change(b.metrics.heapPeakBytes, r.metrics.heapPeakBytes, 0)]);
+    }
+    return [`${head.build} against ${base.build}`, ...formatRows(rows)].join('\n');
+}
+
+// --- Emulator driver ---
+
+/** Python for `rebble repl`, which hands it a connected `pebble` */
+export function configPushScript(uuid: string, messageKeys: Record<string, number>,
+                                 values: Record<string, string | number>): string {
+    const entries = Object.entries(values).map(([key, value]) => {
+        if (messageKeys[key] === undefined) throw new Error(`Unknown message key ${key}`);
+        return `${messageKeys[key]}: ${typeof value === 'number' ? `Int32(${value})` : `CString(${JSON.stringify(value)})`}`;
+    });
+    return ['import uuid',
+            'from libpebble2.services.appmessage import AppMessageService, CString, Int32',
+            `AppMessageService(pebble).send_message(uuid.UUID('${uuid}'), {${entries.join(', ')}})`,
+            ''].join('\n');
+}
+
+interface AppInfo {
+    uuid: string;
+    messageKeys: Record<string, number>;
+}
+
+const sleep = (seconds: number) => new Promise(resolve => setTimeout(resolve, seconds * 1000));
+
+function rebble(platform: string, args: string[], input?: string): string | null {
+    const run = spawnSync('rebble', [...args, '--emulator', platform],
+                          { input, stdio: [input === undefined ? 'ignore' : 'pipe', 'inherit', 'pipe'], encoding: 'utf8' });
+    if (run.error) return run.error.message;
+    return run.status === 0 ? null : `rebble ${args[0]} exited with ${run.status}: ${(run.stderr ?? '').trim()}`;
+}
+
+async function perform(platform: string, app: AppInfo, action: BenchAction): Promise<string | null> {
+    switch (action.kind) {
+        case 'tap': return rebble(platform, ['emu-tap', '--direction', 'x+']);
+        case 'config': return rebble(platform, ['repl'], configPushScript(app.uuid, app.messageKeys, action.values));
+        case 'warm': {
+            const error = rebble(platform, ['emu-button', 'click', 'select']);
+            if (error) return error;
+            await sleep(5);
+            return rebble(platform, ['emu-button', 'click', 'back']);
+        }
+        case 'cold': return rebble(platform, ['install']);
+    }
+}
+
+async function runScenario(platform: string, app: AppInfo, scenario: BenchScenario, year: number): Promise<BenchResult> {
+    const errors: string[] = [];
+    const note = (error: string | null) => { if (error) errors.push(error); };
+    console.log(`${platform} ${scenario.name}: ${scenario.description} (${scenario.seconds} s)`);
+
+    note(rebble(platform, ['emu-set-time', String(scenario.start(year))]));
+    note(rebble(platform, ['install']));
+
+    const summaries: ProfileSummary[] = [];
+    const logs = spawn('rebble', ['logs', '--emulator', platform], { stdio: ['ignore', 'pipe', 'inherit'] });
+    let pending = '';
+    logs.stdout.setEncoding('utf8');
+    logs.stdout.on('data', (chunk: string) => {
+        const lines = (pending + chunk).split('\n');
+        pending = lines.pop() ?? '';
+        for (const line of lines) {
+            const summary = parseProfileLine(line);
+            if (summary) summaries.push(summary);
+        }
+    });
+
+    let elapsed = 0;
+    for (const { at, action } of [...scenario.actions].sort((a, b) => a.at - b.at)) {
+        await sleep(Math.max(0, at - elapsed));
+        elapsed = Math.max(elapsed, at);
+        note(await perform(platform, app, action));
+    }
+    await sleep(Math.max(0, scenario.seconds - elapsed));
+    logs.kill();
+
+    const metrics = summarizeWindows(summaries);
+    if (!metrics) errors.push('no profile summary arrived (is the build from TIDFACE_PROFILER?)');
+    return { platform, scenario: scenario.name, metrics, errors };
+}
+
+async function loadAppInfo(root: string): Promise<AppInfo> {
+    const pkg = JSON.parse(await fs.readFile(path.join(root, 'package.json'), 'utf8'));
+    const keysFile = path.join(root, 'build/js/message_keys.json');
+    const messageKeys = JSON.parse(await fs.readFile(keysFile, 'utf8').catch(() => {
+        throw new Error(`${keysFile} not found, build the face first`);
+    }));
+    return { uuid: pkg.pebble.uuid, messageKeys };
+}
+
+function gitDescribe(root: string): string {
+    const run = spawnSync('git', ['describe', '--always', '--dirty'], { cwd: root, encoding: 'utf8' });
+    return run.status === 0 ? run.stdout.trim() : 'unknown';
+}
+
+async function main() {
+    const root = path.join(__dirname, '..');
+    program
+        .description('Run the emulator scenarios on a profiler build and write a report for it.')
+        .option('--platforms <list>', 'Emulator platforms, comma separated', BENCH_PLATFORMS.join(','))
+        .option('--scenarios <list>', `Scenarios, comma separated (${SCENARIOS.map(s => s.name).join(', ')})`)
+        .option('--year <number>', 'Year of the DST days and slots', (val) => parseInt(val, 10), new Date().getUTCFullYear())
+        .option('--out <dir>', 'Report directory', path.join(root, 'bench'))
+        .option('--compare <report>', 'Earlier report (.json) to compare this build against')
+        .parse(process.argv);
+    const options = program.opts();
+
+    const wanted: string[] | null = options.scenarios ? options.scenarios.split(',') : null;
+    const unknown = (wanted ?? []).filter(name => !SCENARIOS.some(s => s.name === name));
+    if (unknown.length > 0) throw new Error(`Unknown scenario ${unknown.join(', ')}`);
+    const scenarios = SCENARIOS.filter(s => !wanted || wanted.includes(s.name));
+    const baseline: BenchReport | null = options.compare
+        ? JSON.parse(await fs.readFile(options.compare, 'utf8'))
+        : null;
+
+    const app = await loadAppInfo(root);
+    const report: BenchReport = { build: gitDescribe(root), date: new Date().toISOString(), year: options.year, results: [] };
+    for (const platform of options.platforms.split(',')) {
+        for (const scenario of scenarios) report.results.push(await runScenario(platform, app, scenario, options.year));
+    }
+
+    const text = formatBenchReport(report);
+    await fs.mkdir(options.out, { recursive: true });
+    const base = path.join(options.out, report.build);
+    await fs.writeFile(`${base}.json`, JSON.stringify(report, null, 2) + '\n');
+    await fs.writeFile(`${base}.txt`, text + '\n');
+    console.log(text);
+    console.log(`Report: ${base}.json, ${base}.txt`);
+    if (baseline) console.log(formatBenchComparison(baseline, report));
+}
+
+if (require.main === module) {
+    main().catch(error => {
+        console.error('Emulator bench failed:', error);
+        process.exit(1);
+    });
+}
@@ -1,7 +1,8 @@
 import path from 'path';
 import os from 'os';
 import fs from 'fs/promises';
-import { generateCCode } from './generateAirportTzList';
+import { assignAirportCodes, generateCCode, measureAssignment, prepareAirportData } from './generateAirportTzList';
+import { parseAirportDataResource } from './airportDataResource';
 
 // ---------------------------------------------------------------------------
 // Jest setup: mock external dependencies (airport-data package and fetch)
@@ -115,11 +116,82 @@ describe('generateAirportTzList', () => {
     await generateCCode(airportsList, out, 5, 5);
     const content = await fs.readFile(out, 'utf-8');
 
-    // Extract quarter-hour std offsets (first field in each TzInfo entry)
-    const stdOffsetQuarters = Array.from(content.matchAll(/\{\s*([+-]?\d+),/g)).map(m => Number(m[1]));
+    // Extract quarter-hour std offsets (one per line of the std array)
+    const table = content.slice(content.indexOf('airport_tz_std_quarters[] = {'));
+    const stdArray = table.slice(0, table.indexOf('};'));
+    const stdOffsetQuarters = Array.from(stdArray.matchAll(/^\s+([+-]?\d+),/gm)).map(m => Number(m[1]));
     // Convert to hours by dividing by 4
     const stdOffsets = stdOffsetQuarters.map(q => q / 4);
     // Expect three distinct standard offsets: -5, 0, -2 hours
     expect(new Set(stdOffsets)).toEqual(new Set([-5, 0, -2]));
+
+    // Name ranges are back to back: one start per bucket plus the end
+    const starts = content.slice(content.indexOf('airport_tz_name_start[] = {'));
+    const nameStarts = Array.from(starts.slice(0, starts.indexOf('};')).matchAll(/(\d+),/g)).map(m => Number(m[1]));
+    expect(nameStarts).toHaveLength(stdOffsetQuarters.length + 1);
+    expect(nameStarts[0]).toBe(0);
+    expect(nameStarts[nameStarts.length - 1]).toBe(3);
+  });
+
+  test('generateCCode emits a Huffman-coded name pool when compression is enabled', async () => {
+    const out = tmpFile();
+    await generateCCode(airportsList, out, 5, 5, 2025, 2025, true);
+    const content = await fs.readFile(out, 'utf-8');
+
+    expect(content).toMatch(/#define AIRPORT_NAME_HUFF_MAX_BITS \d+/);
+    expect(content).toContain('static const uint8_t airport_name_pool[] = {');
+    expect(content).toContain('// Bit offset of every name in airport_name_pool');
+    expect(content).not.toContain('London Heathrow');
+  });
+
+  test('generateCCode moves buckets, codes and names to the resource blob when asked', async () => {
+    const out = tmpFile();
+    const resourcePath = tmpFile().replace(/\.c$/, '') + '.bin';
+    await generateCCode(airportsList, out, 5, 5, 2025, 2025, true, resourcePath);
+    const content = await fs.readFile(out, 'utf-8');
+    const data = parseAirportDataResource(await fs.readFile(resourcePath));
+
+    expect(content).toContain('#define AIRPORT_DATA_RESOURCE RESOURCE_ID_AIRPORT_DATA');
+    expect(content).toMatch(/#define AIRPORT_TZ_LIST_COUNT 3\n/);
+    expect(content).not.toContain('airport_code_pool_bits');
+    expect(content).not.toContain('airport_tz_std_quarters');
+    expect(content).toContain('airport_tz_events');
+    expect(data.buckets).toHaveLength(3);
+    expect(new Set(data.codes)).toEqual(new Set(['JFK', 'LHR', 'FEN']));
+    expect(data.names[data.codes.indexOf('LHR')]).toBe('London Heathrow');
+  });
+
+  test('generateCCode reports and records the footprint of a tier', async () => {
+    const out = tmpFile();
+    const resourcePath = tmpFile().replace(/\.c$/, '') + '.bin';
+    const footprint = await generateCCode(airportsList, out, 1, 1, 2025, 2025, true, resourcePath, 'compact');
+    const content = await fs.readFile(out, 'utf-8');
+    const resource = await fs.readFile(resourcePath);
+
+    expect(footprint.tier).toBe('compact');
+    expect(footprint.buckets).toBe(3);
+    expect(footprint.resourceBytes).toBe(resource.length);
+    expect(content).toContain('#define AIRPORT_DATA_TIER "compact"');
+    expect(content).toContain(`#define AIRPORT_DATA_FLASH_BYTES ${footprint.flashBytes}\n`);
+    expect(content).toContain(`#define AIRPORT_DATA_RAM_BYTES ${footprint.ramBytes}\n`);
+    expect(footprint.phoneBuckets.zones).toHaveLength(3);
+    expect(content).toContain(`#define AIRPORT_DATA_CHECKSUM 0x${footprint.phoneBuckets.checksum.toString(16).padStart(8, '0')}u\n`);
   });
-}); 
+
+  test('measureAssignment counts the bytes the resource ends up with', async () => {
+    const out = tmpFile();
+    const resourcePath = tmpFile().replace(/\.c$/, '') + '.bin';
+    const prepared = await prepareAirportData(2025, 2025);
+    const measured = measureAssignment(prepared, assignAirportCodes(prepared, airportsList, 5, 5, false),
+                                       5, 5, false, true);
+    await generateCCode(airportsList, out, 5, 5, 2025, 2025, true, resourcePath, null, 1, prepared);
+    const resource = await fs.readFile(resourcePath);
+
+    expect(measured.codeBytes + measured.nameBytes + measured.bucketBytes).toBe(resource.length);
+    expect(measured.airports).toBe(3);
+    expect(measured.zones).toBe(3);
+    expect(measured.coverage).toBe(1);
+    await expect(generateCCode(airportsList, out, 5, 5, 2025, 2026, true, resourcePath, null, 1, prepared))
+      .rejects.toThrow(/covers 2025-2025/);
+  });
+});
@@ -4,6 +4,17 @@ import * as path from 'path';
 // Use require for airport-data as it lacks types
 const airports = require('airport-data');
 import { type DstTransitions } from './tzCommon'; // Only the type DstTransitions is used directly
+import { compressNamePool } from './namePoolCompression';
+import {
+  buildAirportDataResource,
+  AIRPORT_DATA_VERSION,
+  AIRPORT_DATA_HEADER_BYTES,
+  AIRPORT_DATA_BUCKET_BYTES,
+} from './airportDataResource';
+import { type DataFootprint, formatFootprints, loadDataTiers, saveDataTiers, tierOutputPaths } from './dataTiers';
+import { type TableCandidate, formatTableSearch, optimizeTableParams } from './tableOptimizer';
+import { type PhoneBucketTable, phoneBucketTable, writePhoneBuckets } from './phoneSchedule';
+import { precomputeDstTransitions } from './dstWorkerPool';
 import {
   findTzCache,
   memoizedFindTz,
@@ -18,20 +29,80 @@ import {
   OurAirportInfo,
   TzBucketData,
   RouteRecord,
+  ROUTES_URL,
+  OURAIRPORTS_URL,
 } from './generateAirportTzListHelpers';
+import {
+  configureGeneratorCache,
+  fetchTextCached,
+  fileDigest,
+  hashInputs,
+  loadPersistentMemo,
+  outputsUpToDate,
+  packageVersion,
+  recordOutputs,
+  savePersistentMemo,
+  sha256,
+} from './generatorCache';
 
 // Placeholder functions matching Python script structure
 
-async function generateCCode(
-    airportsList: Array<[string, string]>,
-    outPath: string,
-    groupSize: number,
-    maxBucket: number
-): Promise<void> {
-    console.log(`Generating C code for ${outPath}...`);
-    console.log(`Group size: ${groupSize}, Max bucket size: ${maxBucket}`);
+// Watch-side sizes behind the footprint estimate (see clock_closest_airport_noon.h)
+const TZINFO_BYTES = 6;             // former TzInfo row, padded (for the report)
+const BUCKET_STD_BYTES = 1;         // airport_tz_std_quarters entry
+const BUCKET_NAME_BYTES = 2;        // airport_tz_name_start entry (plus one end marker)
+const BUCKET_STATE_BYTES = 3;       // active offset, sorted order, day-offset
+
+/** Airports and DST buckets shared by every variant of a run; the buckets carry no codes */
+interface PreparedAirportData {
+    startYear: number;
+    endYear: number;
+    years: number[];
+    airportDb: Map<string, AirportInfo>;
+    tzBuckets: Map<string, TzBucketData>;
+    groupKeys: Map<number, string[]>;               // std offset -> bucket keys
+    airportsByStdOffset: Map<number, AirportInfo[]>;
+}
+
+/** One variant's buckets in table order, with their code and name pools */
+interface AirportAssignment {
+    sortedBuckets: TzBucketData[];
+    codePool: string[];
+    namePool: string[];       // escaped for C
+    nameOffsets: number[];    // byte offset of each name in the C pool
+    namePoolBytes: number;
+    rawNames: string[];
+}
+
+// DST transitions of a zone for every table year, or null if any fails
+function findYearlyTransitions(tz: string, years: number[]): DstTransitions[] | null {
+    const yearly: DstTransitions[] = [];
+    for (const y of years) {
+        const details = memoizedFindDstTransitions(tz, y);
+        if (!details) return null;
+        yearly.push(details);
+    }
+    return yearly;
+}
 
-    const year = new Date().getUTCFullYear();
+const multiYearBucketKey = (yearly: DstTransitions[]): string => yearly.map(getBucketKey).join('|');
+
+// Loads the airports, corrects their zones and builds the DST buckets
+async function prepareAirportData(
+    startYear: number,
+    endYear: number,
+    dstWorkers: number = 1
+): Promise<PreparedAirportData> {
+    console.log(`DST years: ${startYear}-${endYear}`);
+
+    if (endYear < startYear) {
+        throw new Error(`Invalid year range ${startYear}-${endYear}`);
+    }
+    // Offsets and grouping use the first table year; buckets are split by
+    // their transitions over the whole range.
+    const year = startYear;
+    const years: number[] = [];
+    for (let y = startYear; y <= endYear; y++) years.push(y);
 
     // Load airport data using require
     const airportDataArray = airports as any[];
@@ -104,12 +175,21 @@ async function generateCCode(
 
     // --- Correct timezones and build initial buckets ---
     console.log('Correcting timezones and building initial buckets...');
-    findTzCache.clear();
-    findDstTransitionsCache.clear();
+    // The memo tables are pure lookups, kept across calls and, from the CLI,
+    // across runs (see generatorCache.ts)
     const airportDb = new Map<string, AirportInfo>();
     const tzBuckets = new Map<string, TzBucketData>();
     const groupKeys = new Map<number, string[]>(); // Map: std_offset_s -> [bucketKey, ...]
 
+    // Every zone the loop below can ask for, computed up front (in parallel
+    // unless dstWorkers is 1); the loop then only reads the memo table
+    const zones = new Set<string>();
+    for (const airport of initialAirportDb.values()) {
+        const tz = airport.tz || memoizedFindTz(airport.latitude, airport.longitude)[0];
+        if (tz) zones.add(tz);
+    }
+    await precomputeDstTransitions(zones, years, findDstTransitionsCache, dstWorkers);
+
     let foundFen = false;
     for (const airport of initialAirportDb.values()) {
         const isFen = airport.iata === 'FEN';
@@ -153,8 +233,11 @@ async function generateCCode(
 
         if (!dstDetails) continue; // Skip if memoized function returned null (error or invalid TZ)
 
+        const yearlyDetails = findYearlyTransitions(correctedTz, years);
+        if (!yearlyDetails) continue;
+
         // --- Bucket creation/update logic --- (Restored)
-        const key = getBucketKey(dstDetails);
+        const key = multiYearBucketKey(yearlyDetails);
         const stdOffset = dstDetails[0];
 
         if (!tzBuckets.has(key)) {
@@ -163,6 +246,7 @@ async function generateCCode(
                 dst: dstDetails[1],
                 start: dstDetails[2],
                 end: dstDetails[3],
+                transitions: yearlyDetails,
                 tzNames: new Set([correctedTz]),
                 codes: [],
             });
@@ -197,9 +281,30 @@ async function generateCCode(
     console.log(`Finished pre-grouping into ${airportsByStdOffset.size} standard offset groups.`);
 
     // Check if the Noronha bucket exists after grouping
-    const noronhaKey = `${-7200}_${-7200}_${0}_${0}`; // Expected key: std=-2h, dst=-2h, start=0, end=0
+    const noronhaKey = years.map(() => `${-7200}_${-7200}_${0}_${0}`).join('|'); // Expected key: std=-2h, dst=-2h, start=0, end=0 every year
     console.log(`[NORONHA_DEBUG] Does Noronha bucket key (${noronhaKey}) exist in tzBuckets? ${tzBuckets.has(noronhaKey)}`);
 
+    return { startYear, endYear, years, airportDb, tzBuckets, groupKeys, airportsByStdOffset };
+}
+
+// Picks a variant's airports: the HTML list per std offset (groupSize),
+// fallbacks, then at most maxBucket per bucket.  `verbose` false keeps the
+// table search quiet.
+function assignAirportCodes(
+    prepared: PreparedAirportData,
+    airportsList: Array<[string, string]>,
+    groupSize: number,
+    maxBucket: number,
+    verbose: boolean = true
+): AirportAssignment {
+    const { years, airportDb, groupKeys, airportsByStdOffset } = prepared;
+    const year = prepared.startYear;
+    const log = verbose ? console.log : () => {};
+    const warn = verbose ? console.warn : () => {};
+    // Each variant fills its own copy of the buckets
+    const tzBuckets = new Map<string, TzBucketData>();
+    for (const [key, bucket] of prepared.tzBuckets) tzBuckets.set(key, { ...bucket, codes: [] });
+
     // Determine fallback codes
     const getFallbackCodes = (stdOffsetSeconds: number): string[] => {
         // Retrieve pre-filtered candidates for this standard offset
@@ -279,13 +384,13 @@ async function generateCCode(
             const fallbacks = getFallbackCodes(stdOffset);
             if (fallbacks.length > 0) {
                 groupCodes.set(stdOffset, fallbacks);
-                console.log(`Applied fallback for std offset ${stdOffset/3600}h: ${fallbacks.join(', ')}`);
+                log(`Applied fallback for std offset ${stdOffset/3600}h: ${fallbacks.join(', ')}`);
             } else {
-                console.warn(`No fallback codes found for std offset ${stdOffset/3600}h`);
+                warn(`No fallback codes found for std offset ${stdOffset/3600}h`);
             }
         }
     }
-    console.log(`Grouped codes from HTML/fallbacks into ${groupCodes.size} standard offset groups.`);
+    log(`Grouped codes from HTML/fallbacks into ${groupCodes.size} standard offset groups.`);
 
     // --- Assign codes to final buckets ---
     const usedCodes = new Set<string>();
@@ -297,9 +402,9 @@ async function generateCCode(
 
         try {
             // *** Use memoized version ***
-            const dstDetails = memoizedFindDstTransitions(airportInfo.correctedTz, year);
-            if (!dstDetails) return false;
-            const key = getBucketKey(dstDetails);
+            const yearlyDetails = findYearlyTransitions(airportInfo.correctedTz, years);
+            if (!yearlyDetails) return false;
+            const key = multiYearBucketKey(yearlyDetails);
             const bucket = tzBuckets.get(key);
 
             if (bucket) {
@@ -324,7 +429,7 @@ async function generateCCode(
     }
 
     // --- Final safety pass for empty buckets ---
-    console.log('Running safety pass for empty buckets...');
+    log('Running safety pass for empty buckets...');
     let safetyPassAssigned = 0;
     for (const bucket of tzBuckets.values()) {
         if (bucket.codes.length === 0) {
@@ -341,7 +446,7 @@ async function generateCCode(
             }
         }
     }
-    console.log(`Safety pass assigned codes to ${safetyPassAssigned} previously empty buckets.`);
+    log(`Safety pass assigned codes to ${safetyPassAssigned} previously empty buckets.`);
 
     // Apply maxBucket limit definitively after all assignments
     if (maxBucket > 0) {
@@ -361,6 +466,9 @@ async function generateCCode(
 
     const codePool: string[] = [];
     const namePool: string[] = [];
+    const nameOffsets: number[] = []; // Byte offset of each name in the C pool
+    let namePoolBytes = 0;
+    const rawNames: string[] = [];
     const poolCodeSet = new Set<string>(); // Track codes/names added to pool
 
     // Calculate final offsets and counts
@@ -387,94 +495,384 @@ async function generateCCode(
             } else if (name.endsWith(' Airport')) {
                 name = name.substring(0, name.length - ' Airport'.length);
             }
-            namePool.push(name.trim().replace(/\"/g, '\\\"')); // Escape quotes for C string
+            name = name.trim();
+            rawNames.push(name);
+            nameOffsets.push(namePoolBytes);
+            namePoolBytes += Buffer.byteLength(name, 'utf8') + 1; // + '\0'
+            namePool.push(name.replace(/\"/g, '\\\"')); // Escape quotes for C string
         }
     }
 
+    return { sortedBuckets, codePool, namePool, nameOffsets, namePoolBytes, rawNames };
+}
+
+// Table bytes and zone coverage of a variant, as the table search ranks them
+function measureAssignment(
+    prepared: PreparedAirportData,
+    assignment: AirportAssignment,
+    groupSize: number,
+    maxBucket: number,
+    embedData: boolean,
+    compressNames: boolean
+): TableCandidate {
+    const { sortedBuckets, codePool, rawNames, namePoolBytes } = assignment;
+    // Every zone weighs one plus the route_hits of its airports
+    const weights = new Map<string, number>();
+    for (const bucket of prepared.tzBuckets.values()) {
+        for (const tz of bucket.tzNames) weights.set(tz, 1);
+    }
+    for (const airport of prepared.airportDb.values()) {
+        const weight = weights.get(airport.correctedTz);
+        if (weight !== undefined) weights.set(airport.correctedTz, weight + airport.route_hits);
+    }
+    const shown = new Set<string>();
+    let routeHits = 0;
+    for (const code of codePool) {
+        const airport = prepared.airportDb.get(code);
+        if (!airport) continue;
+        shown.add(airport.correctedTz);
+        routeHits += airport.route_hits;
+    }
+    let total = 0;
+    let covered = 0;
+    for (const [tz, weight] of weights) {
+        total += weight;
+        if (shown.has(tz)) covered += weight;
+    }
+    // Same layouts as the C arrays below and airportDataResource.ts
+    return {
+        groupSize,
+        maxBucket,
+        codeBytes: codePool.length * 2,
+        nameBytes: embedData
+            ? codePool.length * 2 + (compressNames ? compressNamePool(rawNames).compressedBytes : namePoolBytes)
+            : (rawNames.length + 1) * 4 + namePoolBytes - rawNames.length,
+        bucketBytes: embedData
+            ? sortedBuckets.length * (BUCKET_STD_BYTES + BUCKET_NAME_BYTES) + BUCKET_NAME_BYTES
+            : AIRPORT_DATA_HEADER_BYTES + sortedBuckets.length * AIRPORT_DATA_BUCKET_BYTES,
+        airports: codePool.length,
+        zones: shown.size,
+        coverage: total > 0 ? covered / total : 0,
+        routeHits,
+    };
+}
+
+async function generateCCode(
+    airportsList: Array<[string, string]>,
+    outPath: string,
+    groupSize: number,
+    maxBucket: number,
+    startYear: number = new Date().getUTCFullYear(),
+    endYear: number = startYear + 10,
+    compressNames: boolean = false,
+    resourcePath: string | null = null,
+    tierName: string | null = null,
+    dstWorkers: number = 1,
+    prepared: PreparedAirportData | null = null
+): Promise<DataFootprint & { phoneBuckets: PhoneBucketTable }> {
+    console.log(`Generating C code for ${outPath}${tierName ? ` (tier ${tierName})` : ''}...`);
+    console.log(`Group size: ${groupSize}, Max bucket size: ${maxBucket}`);
+
+    const data = prepared ?? await prepareAirportData(startYear, endYear, dstWorkers);
+    if (data.startYear !== startYear || data.endYear !== endYear) {
+        throw new Error(`Prepared data covers ${data.startYear}-${data.endYear}, not ${startYear}-${endYear}`);
+    }
+    const { years } = data;
+    const { sortedBuckets, codePool, namePool, nameOffsets, namePoolBytes, rawNames } =
+        assignAirportCodes(data, airportsList, groupSize, maxBucket);
+
     // --- Generate C Code String ---
     let cContent = `// Auto-generated by generateAirportTzList.ts\n`;
     cContent += `// Generated on: ${new Date().toISOString()}\n`;
-    cContent += `// Year-specific DST data for ${year}\n\n`;
+    cContent += `// DST data for ${startYear}-${endYear}\n\n`;
     cContent += `#include <stdint.h>\n\n`;
 
-    // Airport Code Pool (bit-packed 15 bits/code)
-    cContent += `// Total airport codes: ${codePool.length}  (codes listed for debug)\n`;
-    cContent += `static const uint16_t airport_code_pool_bits[] = {\n`;
-    for (const code of codePool) {
-        // pack each letter A-Z into 5 bits
-        const b0 = code.charCodeAt(0) - 65;
-        const b1 = code.charCodeAt(1) - 65;
-        const b2 = code.charCodeAt(2) - 65;
-        const bits = (b0 << 10) | (b1 << 5) | b2;
-        cContent += `    0x${bits.toString(16)}, /* ${code} */\n`;
-        }
-    cContent += `};\n\n`;
+    // Name pool compression: always computed so the size trade-off shows up in
+    // the log, only emitted when enabled. Offsets then index bits, not bytes.
+    const huff = compressNamePool(rawNames);
+    console.log(`Name pool: raw ${huff.rawBytes} bytes, Huffman ${huff.compressedBytes} bytes ` +
+                `(${huff.symbols.length} symbols, max code ${huff.maxBits} bits, ` +
+                `${huff.rawBytes - huff.compressedBytes} bytes saved)` +
+                `${!compressNames ? ' - compression disabled' : resourcePath ? ' - unused, names are stored raw in the resource' : ''}`);
+
+    // Resource mode: buckets, codes and names go to the binary resource and
+    // the C file keeps only the DST tables and sizes
+    const embedData = resourcePath === null;
+
+    if (embedData) {
+        // Airport Code Pool (bit-packed 15 bits/code)
+        cContent += `// Total airport codes: ${codePool.length}  (codes listed for debug)\n`;
+        cContent += `static const uint16_t airport_code_pool_bits[] = {\n`;
+        for (const code of codePool) {
+            // pack each letter A-Z into 5 bits
+            const b0 = code.charCodeAt(0) - 65;
+            const b1 = code.charCodeAt(1) - 65;
+            const b2 = code.charCodeAt(2) - 65;
+            const bits = (b0 << 10) | (b1 << 5) | b2;
+            cContent += `    0x${bits.toString(16)}, /* ${code} */\n`;
+            }
+        cContent += `};\n\n`;
 
-    // Count of bit-packed airport codes
-    cContent += `#define AIRPORT_CODE_POOL_BITS_COUNT ${codePool.length}\n\n`;
-
-    // Airport Name Pool (pointers to strings)
-    cContent += `// Total airport names: ${namePool.length}\n`;
-    cContent += `static const char airport_name_pool[] =\n`;
-    if (namePool.length > 0) {
-        let line = '    ';
-        for (const name of namePool) {
-            const literal = `"${name}\\0"`;
-            // Break line if too long
-            if (line.length + literal.length + 1 > 80) {
-                cContent += `${line}\n`;
-                line = '    ' + literal + ' ';
+        // Count of bit-packed airport codes
+        cContent += `#define AIRPORT_CODE_POOL_BITS_COUNT ${codePool.length}\n\n`;
+
+        if (compressNames) {
+            if (huff.bits.length * 8 > 0xFFFF) {
+                throw new Error(`Compressed name pool too large for 16-bit bit offsets: ${huff.bits.length * 8} bits`);
+            }
+            cContent += `// Canonical Huffman code for airport names: codes per length, then\n`;
+            cContent += `// symbols in code order (NUL terminates a name)\n`;
+            cContent += `#define AIRPORT_NAME_HUFF_MAX_BITS ${huff.maxBits}\n`;
+            cContent += `static const uint8_t airport_name_huff_counts[] = {\n`;
+            cContent += `    ${huff.counts.join(', ')}\n`;
+            cContent += `};\n\n`;
+            cContent += `static const uint8_t airport_name_huff_symbols[] = {\n`;
+            for (let i = 0; i < huff.symbols.length; i += 12) {
+                cContent += `    ${huff.symbols.slice(i, i + 12).join(', ')},\n`;
+            }
+            cContent += `};\n\n`;
+
+            cContent += `// Total airport names: ${namePool.length} (Huffman-coded, MSB first)\n`;
+            cContent += `static const uint8_t airport_name_pool[] = {\n`;
+            for (let i = 0; i < huff.bits.length; i += 12) {
+                const row = huff.bits.slice(i, i + 12).map(b => `0x${b.toString(16).padStart(2, '0')}`);
+                cContent += `    ${row.join(', ')},\n`;
+            }
+            if (huff.bits.length === 0) cContent += `    0 // Empty pool\n`;
+            cContent += `};\n\n`;
+        } else {
+            // Airport Name Pool (pointers to strings)
+            cContent += `// Total airport names: ${namePool.length}\n`;
+            cContent += `static const char airport_name_pool[] =\n`;
+            if (namePool.length > 0) {
+                let line = '    ';
+                for (const name of namePool) {
+                    const literal = `"${name}\\0"`;
+                    // Break line if too long
+                    if (line.length + literal.length + 1 > 80) {
+                        cContent += `${line}\n`;
+                        line = '    ' + literal + ' ';
+                    } else {
+                        line += literal + ' ';
+                    }
+                }
+                if (line.trim().length > 0) {
+                    cContent += `${line.trimEnd()}\n`;
+                }
+                cContent += `;\n\n`;
             } else {
-                line += literal + ' ';
+                cContent += `    "\0"; // Empty pool\n\n`;
+            }
+
+            if (namePoolBytes > 0xFFFF) {
+                throw new Error(`Name pool too large for 16-bit offsets: ${namePoolBytes} bytes`);
             }
         }
-        if (line.trim().length > 0) {
-            cContent += `${line.trimEnd()}\n`;
+
+        // Name offset index: constant-time lookup of the Nth name
+        const offsets = compressNames ? huff.bitOffsets : nameOffsets;
+        cContent += compressNames
+            ? `// Bit offset of every name in airport_name_pool (${huff.bits.length} bytes)\n`
+            : `// Byte offset of every name in airport_name_pool (${namePoolBytes} bytes)\n`;
+        cContent += `static const uint16_t airport_name_offsets[] = {\n`;
+        if (offsets.length > 0) {
+            for (let i = 0; i < offsets.length; i += 12) {
+                cContent += `    ${offsets.slice(i, i + 12).join(', ')},\n`;
+            }
+        } else {
+            cContent += `    0 // Empty pool\n`;
         }
-        cContent += `;\n\n`;
-    } else {
-        cContent += `    "\0"; // Empty pool\n\n`;
+        cContent += `};\n\n`;
     }
 
-    // Packed TzInfo struct: quarter-hours and 32-bit UTC
-    cContent += `typedef struct {\n`;
-    cContent += `    int8_t  std_quarters;    // std offset in 0.25h units\n`;
-    cContent += `    int8_t  dst_quarters;    // dst offset in 0.25h units\n`;
-    cContent += `    int32_t dst_start_utc;   // DST start (seconds since epoch)\n`;
-    cContent += `    int32_t dst_end_utc;     // DST end (seconds since epoch)\n`;
-    cContent += `    uint16_t name_offset;    // Index into airport_name_pool\n`;
-    cContent += `    uint8_t  name_count;     // Number of codes in this bucket\n`;
-    cContent += `} TzInfo;\n\n`;
-
-    // airport_tz_list array: packed quarters and 32-bit DST timestamps
+    // Bucket table as parallel arrays, split by access: std offsets (read
+    // when the active offsets are reset) and name ranges (read for picked
+    // buckets only).  dst offsets and DST windows live in the per-year event
+    // table below, so only buckets that observe DST cost anything there.
+    // Each bucket's codes follow the previous bucket's, so one start per
+    // bucket plus an end marker gives both offset and count.  In resource
+    // mode the same rows are listed as a comment for reference.
     cContent += `// Total timezone variants: ${sortedBuckets.length}\n`;
-    cContent += `static const TzInfo airport_tz_list[] = {\n`;
-    if (sortedBuckets.length > 0) {
+    const bucketComment = (bucket: TzBucketData): string =>
+        `${Array.from(bucket.tzNames).slice(0,3).join(', ')} ` +
+        `(${(bucket.std / 3600.0).toFixed(2)}h/${(bucket.dst / 3600.0).toFixed(2)}h)`;
+    if (embedData) {
+        // pack standard offsets: seconds -> quarter-hours (900s)
+        cContent += `static const int8_t airport_tz_std_quarters[] = {\n`;
+        for (const bucket of sortedBuckets) {
+            cContent += `    ${Math.round(bucket.std / 900)}, // ${bucketComment(bucket)}\n`;
+        }
+        if (sortedBuckets.length === 0) cContent += `    0 // Empty list\n`;
+        cContent += `};\n\n`;
+        const nameStarts = [...sortedBuckets.map(bucket => bucket.offset ?? 0), codePool.length];
+        cContent += `// Bucket i owns codes [airport_tz_name_start[i], airport_tz_name_start[i + 1])\n`;
+        cContent += `static const uint16_t airport_tz_name_start[] = {\n`;
+        for (let i = 0; i < nameStarts.length; i += 12) {
+            cContent += `    ${nameStarts.slice(i, i + 12).join(', ')},\n`;
+        }
+        cContent += `};\n\n`;
+    } else {
+        cContent += `// Bucket table (loaded from the airport data resource at runtime):\n`;
         for (const bucket of sortedBuckets) {
-            // pack standard/dst offsets: seconds -> quarter-hours (900s)
-            const stdQ = Math.round(bucket.std / 900);
-            const dstQ = Math.round(bucket.dst / 900);
-            // original hours for debug
-            const std_h = (bucket.std / 3600.0).toFixed(2);
-            const dst_h = (bucket.dst / 3600.0).toFixed(2);
-            const tzComment = Array.from(bucket.tzNames).slice(0,3).join(', ');
-            cContent += `    { ${stdQ}, ${dstQ}, ${bucket.start}, ${bucket.end}, ${bucket.offset ?? 0}, ${bucket.count ?? 0} }, // ${tzComment} (${std_h}h/${dst_h}h)\n`;
+            cContent += `//   { ${Math.round(bucket.std / 900)}, ${Math.round(bucket.dst / 900)}, ` +
+                        `${bucket.offset ?? 0}, ${bucket.count ?? 0} }, // ${bucketComment(bucket)}\n`;
+        }
+        if (sortedBuckets.length === 0) cContent += `//   // Empty list\n`;
+        cContent += `\n`;
+    }
+    const bucketBytes = sortedBuckets.length * (BUCKET_STD_BYTES + BUCKET_NAME_BYTES) + BUCKET_NAME_BYTES;
+    console.log(`Bucket table: ${sortedBuckets.length} buckets, ${bucketBytes} bytes ` +
+                `(${BUCKET_STD_BYTES + BUCKET_NAME_BYTES} bytes per bucket + ${BUCKET_NAME_BYTES}, ` +
+                `was ${TZINFO_BYTES} per bucket, ${sortedBuckets.length * TZINFO_BYTES} bytes, as TzInfo rows)`);
+
+    // DST transition events, delta-encoded per year: a year table gives each
+    // year's UTC start and first event, events store hours since that start.
+    // The runtime keeps a cursor into this list instead of testing every
+    // bucket's DST window.
+    if (sortedBuckets.length > 254) {
+        throw new Error(`Too many tz buckets for 8-bit bucket indices (0xFF means none): ${sortedBuckets.length}`);
+    }
+    type TzEventRow = { year: number; hour: number; bucket: number; quarters: number; tz: string };
+    const yearStartUtc = (y: number): number => Date.UTC(y, 0, 1) / 1000;
+    const eventsByYear: TzEventRow[][] = years.map(() => []);
+    const pushEvent = (utc: number, bucket: number, quarters: number, tz: string) => {
+        const yi = years.findIndex(y => utc >= yearStartUtc(y) && utc < yearStartUtc(y + 1));
+        if (yi < 0) throw new Error(`Transition ${utc} for ${tz} is outside ${startYear}-${endYear}`);
+        const secs = utc - yearStartUtc(years[yi]);
+        if (secs % 3600 !== 0) throw new Error(`Transition ${utc} for ${tz} is not on an hour boundary`);
+        eventsByYear[yi].push({ year: years[yi], hour: secs / 3600, bucket, quarters, tz });
+    };
+    sortedBuckets.forEach((bucket, index) => {
+        const tz = Array.from(bucket.tzNames)[0];
+        const first = bucket.transitions[0];
+        // Buckets already in DST on Jan 1 of the first year (southern
+        // hemisphere) start with an hour-0 event; all others start on std.
+        if (first[3] !== 0 && (first[2] === 0 || first[2] > first[3])) {
+            pushEvent(yearStartUtc(startYear), index, Math.round(first[1] / 900), tz);
+        }
+        for (const [std, dst, start, end] of bucket.transitions) {
+            if (start !== 0) pushEvent(start, index, Math.round(dst / 900), tz);
+            if (end !== 0) pushEvent(end, index, Math.round(std / 900), tz);
+        }
+    });
+    const events: TzEventRow[] = [];
+    for (const list of eventsByYear) {
+        list.sort((a, b) => (a.hour - b.hour) || (a.bucket - b.bucket));
+        events.push(...list);
+    }
+
+    cContent += `typedef struct {\n`;
+    cContent += `    uint16_t hour;           // hours since the start of its table year (UTC)\n`;
+    cContent += `    uint8_t  bucket;         // index into the bucket table\n`;
+    cContent += `    int8_t   quarters;       // offset in effect from then on, 0.25h units\n`;
+    cContent += `} TzEvent;\n\n`;
+
+    cContent += `typedef struct {\n`;
+    cContent += `    int32_t  start_utc;      // Jan 1 00:00 UTC of the year\n`;
+    cContent += `    uint16_t first_event;    // index of its first event in airport_tz_events\n`;
+    cContent += `} TzYear;\n\n`;
+
+    cContent += `// Total DST transition events: ${events.length}\n`;
+    cContent += `static const TzEvent airport_tz_events[] = {\n`;
+    if (events.length > 0) {
+        for (const ev of events) {
+            cContent += `    { ${ev.hour}, ${ev.bucket}, ${ev.quarters} }, // ${ev.year} ${ev.tz} -> ${(ev.quarters / 4).toFixed(2)}h\n`;
         }
     } else {
-         cContent += `    // Empty list\n`;
+        cContent += `    { 0, 0, 0 } // Empty list (never read, AIRPORT_TZ_EVENT_COUNT is 0)\n`;
     }
     cContent += `};\n\n`;
 
+    // One row per year plus a closing sentinel
+    cContent += `static const TzYear airport_tz_years[] = {\n`;
+    let firstEvent = 0;
+    years.forEach((y, yi) => {
+        cContent += `    { ${yearStartUtc(y)}, ${firstEvent} }, // ${y}\n`;
+        firstEvent += eventsByYear[yi].length;
+    });
+    cContent += `    { ${yearStartUtc(endYear + 1)}, ${firstEvent} }, // end\n`;
+    cContent += `};\n\n`;
+
+    // Flash cost of the DST table: what each year beyond the first adds
+    const EVENT_BYTES = 4;
+    const YEAR_BYTES = 8;
+    const extraYears = years.length - 1;
+    const extraYearBytes = extraYears > 0
+        ? (events.length - eventsByYear[0].length) * EVENT_BYTES + extraYears * YEAR_BYTES
+        : 0;
+    console.log(`DST table: ${events.length} events over ${years.length} years, ` +
+                `${events.length * EVENT_BYTES + (years.length + 1) * YEAR_BYTES} bytes; ` +
+                `${extraYears > 0 ? Math.round(extraYearBytes / extraYears) : 0} bytes per extra year`);
+
+    // Resource blob: written next to the C file so both always match
+    let resource: Buffer | null = null;
+    if (resourcePath !== null) {
+        resource = buildAirportDataResource({
+            buckets: sortedBuckets.map(bucket => ({
+                stdQuarters: Math.round(bucket.std / 900),
+                dstQuarters: Math.round(bucket.dst / 900),
+                nameOffset: bucket.offset ?? 0,
+                nameCount: bucket.count ?? 0,
+            })),
+            codes: codePool,
+            names: rawNames,
+        });
+        cContent += `// Buckets, codes and names live in ${path.basename(resourcePath)}\n`;
+        cContent += `#define AIRPORT_DATA_RESOURCE RESOURCE_ID_AIRPORT_DATA\n`;
+        cContent += `#define AIRPORT_DATA_VERSION ${AIRPORT_DATA_VERSION}\n`;
+        cContent += `#define AIRPORT_DATA_BYTES ${resource.length}\n`;
+    }
+
     // Definitions for counts
-    cContent += `#define AIRPORT_TZ_LIST_COUNT (sizeof(airport_tz_list)/sizeof(airport_tz_list[0]))\n`;
+    cContent += `#define AIRPORT_TZ_LIST_COUNT ${sortedBuckets.length}\n`;
     cContent += `#define AIRPORT_CODE_POOL_COUNT ${codePool.length}\n`;
     cContent += `#define AIRPORT_NAME_POOL_COUNT ${namePool.length}\n`;
+    cContent += `#define AIRPORT_NAME_POOL_BYTES ${!embedData ? namePoolBytes - namePool.length : compressNames ? huff.bits.length : namePoolBytes}\n`;
+    cContent += `#define AIRPORT_NAME_MAX_LEN ${huff.maxNameBytes}\n`;
+    cContent += `#define AIRPORT_TZ_EVENT_COUNT ${events.length}\n`;
+    cContent += `#define AIRPORT_TZ_FIRST_YEAR ${startYear}\n`;
+    cContent += `#define AIRPORT_TZ_YEAR_COUNT ${years.length}\n`;
+
+    // Bucket table identity for the phone schedule
+    const phoneBuckets = phoneBucketTable(tierName ?? 'default', sortedBuckets.map(bucket => ({
+        zone: Array.from(bucket.tzNames)[0],
+        stdQuarters: Math.round(bucket.std / 900),
+        dstQuarters: Math.round(bucket.dst / 900),
+    })));
+    cContent += `\n// Identifies this bucket table to the phone schedule (src/pkjs/schedule.js)\n`;
+    cContent += `#define AIRPORT_DATA_CHECKSUM 0x${phoneBuckets.checksum.toString(16).padStart(8, '0')}u\n`;
+
+    // What this variant costs on the watch (estimate for the RAM part)
+    const footprint: DataFootprint = {
+        tier: tierName ?? 'default',
+        buckets: sortedBuckets.length,
+        codes: codePool.length,
+        events: events.length,
+        flashBytes: events.length * EVENT_BYTES + (years.length + 1) * YEAR_BYTES +
+                    (embedData ? bucketBytes + codePool.length * 4 +
+                                 (compressNames ? huff.compressedBytes : namePoolBytes) : 0),
+        resourceBytes: resource ? resource.length : 0,
+        ramBytes: sortedBuckets.length * BUCKET_STATE_BYTES + (embedData ? 0 : bucketBytes) +
+                  (embedData && !compressNames ? 0 : huff.maxNameBytes + 1),
+    };
+    cContent += `\n// Data footprint, printed per platform by wscript\n`;
+    if (tierName) cContent += `#define AIRPORT_DATA_TIER "${tierName}"\n`;
+    cContent += `#define AIRPORT_DATA_FLASH_BYTES ${footprint.flashBytes}\n`;
+    cContent += `#define AIRPORT_DATA_RAM_BYTES ${footprint.ramBytes}\n`;
 
     // --- Write C Code to File ---
     // --- 7. Write C Code to File --- 
     await fs.writeFile(outPath, cContent, 'utf-8');
+    if (resourcePath !== null && resource !== null) {
+        await fs.mkdir(path.dirname(resourcePath), { recursive: true });
+        await fs.writeFile(resourcePath, resource);
+        console.log(`Airport data resource: ${resource.length} bytes in ${resourcePath} ` +
+                    `(${sortedBuckets.length * AIRPORT_DATA_BUCKET_BYTES} bytes of bucket rows are loaded into RAM, ` +
+                    `codes and names are read on demand)`);
+    }
 
     console.log(`Successfully generated ${outPath} with ${sortedBuckets.length} tz buckets and ${codePool.length} unique airports.`);
+    return { ...footprint, phoneBuckets };
 }
 
 async function main() {
@@ -485,6 +883,19 @@ async function main() {
         .option('--out <path>', 'C output file path', path.join(__dirname, '../src/c/airport_tz_list.c'))
         .option('--top <number>', 'Number of airports per std offset group (from HTML)', (val) => parseInt(val, 10), 10)
         .option('--max-bucket <number>', 'Max unique airports per DST bucket', (val) => parseInt(val, 10), 10)
+        .option('--tiers <path>', 'Per-platform data tiers (groupSize/maxBucket per variant)', path.join(__dirname, 'dataTiers.json'))
+        .option('--no-tiers', 'Write a single variant from --top and --max-bucket')
+        .option('--optimize', 'Search groupSize/maxBucket for the tiers with a budgetBytes and save the picks')
+        .option('--start-year <number>', 'First year of DST data', (val) => parseInt(val, 10), new Date().getUTCFullYear())
+        .option('--end-year <number>', 'Last year of DST data (default: start year + 10)', (val) => parseInt(val, 10))
+        .option('--no-compress-names', 'Emit the airport name pool as plain strings instead of Huffman-coded')
+        .option('--resource-out <path>', 'Airport data resource output path', path.join(__dirname, '../resources/data/airport_data.bin'))
+        .option('--no-resource', 'Embed buckets, codes and names in the C file instead of the resource')
+        .option('--phone-out <path>', 'Bucket tables for the phone schedule', path.join(__dirname, '../src/pkjs/airport_buckets.json'))
+        .option('--dst-workers <number>', 'Threads for DST transitions (0: one per CPU, 1: inline)', (val) => parseInt(val, 10), 0)
+        .option('--cache-dir <path>', 'Download, lookup and input-hash cache', path.join(__dirname, '.cache'))
+        .option('--no-cache', 'Always download and recompute everything')
+        .option('--force', 'Regenerate even if the inputs are unchanged')
         .parse(process.argv);
 
     const options = program.opts();
@@ -509,7 +920,96 @@ async function main() {
 
     // Generate C code
     try {
-        await generateCCode(airportsList, options.out, options.top, options.maxBucket);
+        const endYear = options.endYear ?? options.startYear + 10;
+        const resourcePath = options.resource ? options.resourceOut : null;
+
+        // One variant per data tier, or a single one from --top/--max-bucket
+        const tiers = options.tiers ? await loadDataTiers(options.tiers) : null;
+        const variants = tiers
+            ? tiers.tiers.map(tier => ({ tier, ...tierOutputPaths(tier, tiers, options.out, resourcePath) }))
+            : [{ tier: null, out: options.out as string, resources: resourcePath ? [resourcePath as string] : [] }];
+        const outputs = [...variants.flatMap(v => [v.out, ...v.resources]), options.phoneOut as string];
+
+        // Cached inputs: downloads are revalidated, lookups reloaded, and an
+        // unchanged input hash with untouched outputs means nothing to do
+        configureGeneratorCache(options.cache ? options.cacheDir : null);
+        const tzNamespace = `geo-tz ${packageVersion('geo-tz')}`;
+        const dstNamespace = `luxon ${packageVersion('luxon')} tz ${process.versions.tz ?? 'unknown'} ` +
+                             `tzCommon ${await fileDigest(path.join(__dirname, 'tzCommon.ts'))}`;
+        let inputHash: string | null = null;
+        if (options.cache) {
+            const tzHits = await loadPersistentMemo('find-tz', findTzCache, tzNamespace);
+            const dstHits = await loadPersistentMemo('dst-transitions', findDstTransitionsCache, dstNamespace);
+            console.log(`[cache] ${tzHits} timezone lookups and ${dstHits} DST transition sets reloaded`);
+
+            const body = async (url: string) => fetchTextCached(url).then(sha256, () => null);
+            const sources = ['generateAirportTzList.ts', 'generateAirportTzListHelpers.ts', 'tzCommon.ts',
+                             'namePoolCompression.ts', 'airportDataResource.ts', 'generatorCache.ts', 'dataTiers.ts',
+                             'phoneSchedule.ts', 'dstWorkerPool.ts', 'tableOptimizer.ts'];
+            const sourceDigests = await Promise.all(sources.map(f => fileDigest(path.join(__dirname, f))));
+            inputHash = hashInputs({
+                html: await fileDigest(options.html),
+                routes: await body(ROUTES_URL),
+                ourAirports: await body(OURAIRPORTS_URL),
+                airportData: packageVersion('airport-data'),
+                tzNamespace,
+                dstNamespace,
+                sources: sha256(sourceDigests.join(',')),
+                options: JSON.stringify([path.resolve(options.out), resourcePath && path.resolve(resourcePath),
+                                         path.resolve(options.phoneOut),
+                                         options.top, options.maxBucket, options.startYear, endYear,
+                                         options.compressNames, tiers, options.optimize ?? false]),
+            });
+            if (!options.force && await outputsUpToDate(inputHash, outputs)) {
+                console.log(`Inputs unchanged (${inputHash.slice(0, 12)}), ${outputs.join(' and ')} up to date; nothing to do.`);
+                return;
+            }
+        }
+
+        // Downloads, lookups and buckets are shared, so extra tiers (and the
+        // table search) only cost the code assignment and output
+        const prepared = await prepareAirportData(options.startYear, endYear, options.dstWorkers);
+        if (tiers && options.optimize) {
+            for (const { tier } of variants) {
+                if (!tier || tier.budgetBytes === undefined) continue;
+                const search = optimizeTableParams((groupSize, maxBucket) => measureAssignment(
+                    prepared, assignAirportCodes(prepared, airportsList, groupSize, maxBucket, false),
+                    groupSize, maxBucket, resourcePath === null, options.compressNames), tier.budgetBytes);
+                console.log(formatTableSearch(tier.name, search));
+                if (!search.best) {
+                    throw new Error(`Tier ${tier.name}: no groupSize/maxBucket fits ${tier.budgetBytes} bytes`);
+                }
+                tier.groupSize = search.best.groupSize;
+                tier.maxBucket = search.best.maxBucket;
+            }
+            await saveDataTiers(options.tiers, tiers);
+            console.log(`Saved the picked parameters to ${options.tiers}`);
+        }
+        const footprints: Array<DataFootprint & { phoneBuckets: PhoneBucketTable }> = [];
+        for (const variant of variants) {
+            const [firstResource, ...copies] = variant.resources;
+            footprints.push(await generateCCode(airportsList, variant.out,
+                                                variant.tier ? variant.tier.groupSize : options.top,
+                                                variant.tier ? variant.tier.maxBucket : options.maxBucket,
+                                                options.startYear, endYear, options.compressNames,
+                                                firstResource ?? null, variant.tier ? variant.tier.name : null,
+                                                options.dstWorkers, prepared));
+            for (const copy of copies) await fs.copyFile(firstResource, copy);
+        }
+        await writePhoneBuckets(options.phoneOut, footprints.map(f => f.phoneBuckets));
+        console.log(`Phone schedule bucket tables: ${options.phoneOut}`);
+        console.log(`Data footprint per variant:\n${formatFootprints(footprints)}`);
+        if (tiers) {
+            for (const { tier } of variants) {
+                console.log(`  ${tier!.name}: ${tier!.platforms.join(', ') || '(default only)'}`);
+            }
+        }
+
+        if (inputHash !== null) {
+            await savePersistentMemo('find-tz', findTzCache, tzNamespace);
+            await savePersistentMemo('dst-transitions', findDstTransitionsCache, dstNamespace);
+            await recordOutputs(inputHash, outputs);
+        }
         console.log('Airport timezone list generation finished successfully.');
     } catch (error) {
         console.error('Airport timezone list generation failed:', error);
@@ -521,7 +1021,10 @@ async function main() {
 // Exports for unit testing
 // ------------------------------------------------------------
 export {
+    assignAirportCodes,
     generateCCode,
+    measureAssignment,
+    prepareAirportData,
     memoizedFindDstTransitions,
     memoizedFindTz,
 };
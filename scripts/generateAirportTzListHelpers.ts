@@ -3,6 +3,10 @@ import * as cheerio from 'cheerio';
 import { find as findTz } from 'geo-tz';
 import { parse as parseSync } from 'csv-parse/sync';
 import { findDstTransitions, DstTransitions } from './tzCommon';
+import { fetchTextCached } from './generatorCache';
+
+export const ROUTES_URL = 'https://raw.githubusercontent.com/jpatokal/openflights/master/data/routes.dat';
+export const OURAIRPORTS_URL = 'https://davidmegginson.github.io/ourairports-data/airports.csv';
 
 // ---------------------------------------------------------------------------
 // Memoization Caches
@@ -77,6 +81,7 @@ export interface TzBucketData {
     dst: number;
     start: number;
     end: number;
+    transitions: DstTransitions[]; // One entry per table year, first year first
     tzNames: Set<string>;
     codes: string[];
     offset?: number;
@@ -126,11 +131,8 @@ export async function parseTopHtml(htmlPath: string): Promise<Array<[string, str
 /** Download and parse OpenFlights routes.dat */
 export async function downloadRoutesCsv(): Promise<RouteRecord[]> {
     console.log('Downloading and parsing routes data...');
-    const url = 'https://raw.githubusercontent.com/jpatokal/openflights/master/data/routes.dat';
     try {
-        const response = await fetch(url);
-        if (!response.ok) throw new Error(`Failed to fetch ${url}: ${response.statusText}`);
-        const text = await response.text();
+        const text = await fetchTextCached(ROUTES_URL);
         console.log('Routes data downloaded, parsing...');
         // Parse CSV synchronously to avoid lingering parser handles
         const rawRecords = parseSync(text, { delimiter: ',', columns: false, skip_empty_lines: true, trim: true }) as string[][];
@@ -172,12 +174,9 @@ export async function rankAirportsByRoutes(routes: RouteRecord[]): Promise<Map<s
 /** Download and parse OurAirports CSV */
 export async function downloadOurAirportsCsv(): Promise<Map<string, OurAirportInfo>> {
     console.log('Downloading and parsing OurAirports data...');
-    const url = 'https://davidmegginson.github.io/ourairports-data/airports.csv';
     const ourAirportsMap = new Map<string, OurAirportInfo>();
     try {
-        const response = await fetch(url);
-        if (!response.ok) throw new Error(`Failed to fetch ${url}: ${response.statusText}`);
-        const text = await response.text();
+        const text = await fetchTextCached(OURAIRPORTS_URL);
         console.log('OurAirports data downloaded, parsing...');
         // Parse CSV synchronously to avoid lingering parser handles
         const rawRecords: Array<Record<string, string>> = parseSync(text, { delimiter: ',', columns: true, skip_empty_lines: true, trim: true });
@@ -1,6 +1,12 @@
 // scripts/generateExpectedTransitions.ts
-// Temporary script to generate expected DST transitions for tzCommon.test.ts
-
+// Generates expected DST transitions for tzCommon.test.ts and, with
+// --buckets, the exact per-bucket UTC offsets the host simulator in
+// test/host checks every 15-minute pick against:
+//
+//   ts-node generateExpectedTransitions.ts --buckets ../src/c/airport_tz_list.c \
+//       --year 2025 > ../test/host/expected_offsets_2025.txt
+
+import * as fs from 'fs';
 import { DateTime } from 'luxon';
 import { IANAZone } from 'luxon';
 import { DstTransitions } from './tzCommon'; // Import the type
@@ -108,16 +114,78 @@ function calculateTransitions(zoneName: string, year: number): DstTransitions {
   return [stdOffsetSec, dstOffsetSec, startTs, endTs];
 }
 
-// --- Generate the output --- 
-console.log(`// Generated for year ${TARGET_YEAR} by generateExpectedTransitions.ts`);
-console.log('const expectedTransitions: { zone: string; expected: DstTransitions }[] = [');
+// --- Bucket offsets for the host simulator ---
+
+/** UTC offset in seconds of `zoneName` at epoch second `ts` */
+function offsetAt(zoneName: string, ts: number): number {
+  return DateTime.fromSeconds(ts, { zone: zoneName }).offset * 60;
+}
+
+/**
+ * Exact offset changes of a zone in [from, to): hourly scan, then a binary
+ * search down to the second for every hour in which the offset changed.
+ */
+function offsetChanges(zoneName: string, from: number, to: number): Array<[number, number]> {
+  const changes: Array<[number, number]> = [];
+  let prevTs = from;
+  let prevOffset = offsetAt(zoneName, from);
+  for (let ts = from + 3600; ts < to + 3600; ts += 3600) {
+    const end = Math.min(ts, to);
+    const offset = offsetAt(zoneName, end);
+    if (offset !== prevOffset) {
+      let lo = prevTs; // offset(lo) === prevOffset
+      let hi = end;    // offset(hi) !== prevOffset
+      while (hi - lo > 1) {
+        const mid = Math.floor((lo + hi) / 2);
+        if (offsetAt(zoneName, mid) === prevOffset) lo = mid;
+        else hi = mid;
+      }
+      changes.push([hi, offset]);
+    }
+    prevTs = end;
+    prevOffset = offset;
+  }
+  return changes;
+}
+
+/** Prints one line per bucket of the generated C table: first zone and its offsets */
+function printBucketOffsets(cPath: string, year: number): void {
+  const content = fs.readFileSync(cPath, 'utf-8');
+  // Embedded table, or the commented copy the resource build leaves behind
+  const embedded = content.indexOf('airport_tz_std_quarters[] = {');
+  const table = content.slice(embedded >= 0 ? embedded : content.indexOf('// Bucket table'));
+  const rows = table.slice(0, table.indexOf(embedded >= 0 ? '};' : '\n\n'));
+  const zones = Array.from(rows.matchAll(/,\s*\/\/\s*([^,(\s]+)/g)).map(m => m[1]);
+  const from = Math.floor(DateTime.utc(year, 1, 1).toSeconds());
+  const to = Math.floor(DateTime.utc(year + 1, 1, 1).toSeconds());
+
+  console.log(`# Exact UTC offsets (seconds) of the first zone of every bucket in airport_tz_list.c`);
+  console.log(`# Generated by generateExpectedTransitions.ts --buckets --year ${year}`);
+  console.log(`# <bucket> <zone> <offset at year start> [<utc> <new offset>]...`);
+  console.log(`year ${year}`);
+  zones.forEach((zone, i) => {
+    const changes = offsetChanges(zone, from, to).map(([ts, off]) => `${ts} ${off}`);
+    console.log([i, zone, offsetAt(zone, from), ...changes].join(' '));
+  });
+}
 
-ZONES_TO_TEST.forEach(zone => {
-  const transitions = calculateTransitions(zone, TARGET_YEAR);
-  console.log(`  {
+// --- Generate the output --- 
+const bucketsArg = process.argv.indexOf('--buckets');
+if (bucketsArg !== -1) {
+  const yearArg = process.argv.indexOf('--year');
+  const year = yearArg !== -1 ? parseInt(process.argv[yearArg + 1], 10) : TARGET_YEAR;
+  printBucketOffsets(process.argv[bucketsArg + 1], year);
+} else {
+  console.log(`// Generated for year ${TARGET_YEAR} by generateExpectedTransitions.ts`);
+  console.log('const expectedTransitions: { zone: string; expected: DstTransitions }[] = [');
+
+  ZONES_TO_TEST.forEach(zone => {
+    const transitions = calculateTransitions(zone, TARGET_YEAR);
+    console.log(`  {
     zone: '${zone}',
     expected: [${transitions.join(', ')}] as DstTransitions,
   },`);
-});
+  });
 
-console.log('];'); 
+  console.log('];');
+}
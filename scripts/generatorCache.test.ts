@@ -0,0 +1,86 @@
+import path from 'path';
+import os from 'os';
+import fs from 'fs/promises';
+import {
+  configureGeneratorCache,
+  fetchTextCached,
+  hashInputs,
+  loadPersistentMemo,
+  outputsUpToDate,
+  recordOutputs,
+  savePersistentMemo,
+} from './generatorCache';
+
+const URL = 'https://example.com/routes.dat';
+
+function response(status: number, body: string, headers: Record<string, string> = {}): any {
+  return {
+    ok: status >= 200 && status < 300,
+    status,
+    statusText: String(status),
+    headers: { get: (name: string) => headers[name.toLowerCase()] ?? null },
+    text: async () => body,
+  };
+}
+
+describe('generatorCache', () => {
+  let dir: string;
+  const fetchMock = jest.fn();
+
+  beforeEach(async () => {
+    dir = await fs.mkdtemp(path.join(os.tmpdir(), 'generator_cache_'));
+    configureGeneratorCache(dir);
+    fetchMock.mockReset();
+    global.fetch = fetchMock as any;
+  });
+
+  afterAll(() => {
+    configureGeneratorCache(null);
+    // @ts-expect-error restore fetch
+    delete global.fetch;
+  });
+
+  test('revalidates a cached download with its ETag and reuses it on 304', async () => {
+    fetchMock.mockResolvedValueOnce(response(200, 'a,b', { etag: '"v1"' }));
+    expect(await fetchTextCached(URL)).toBe('a,b');
+
+    configureGeneratorCache(dir); // new run
+    fetchMock.mockResolvedValueOnce(response(304, ''));
+    expect(await fetchTextCached(URL)).toBe('a,b');
+    expect(fetchMock.mock.calls[1][1].headers['If-None-Match']).toBe('"v1"');
+  });
+
+  test('falls back to the cached body when offline, and fetches once per run', async () => {
+    fetchMock.mockResolvedValueOnce(response(200, 'x', { 'last-modified': 'Mon, 05 May 2025 00:00:00 GMT' }));
+    await fetchTextCached(URL);
+    await fetchTextCached(URL);
+    expect(fetchMock).toHaveBeenCalledTimes(1);
+
+    configureGeneratorCache(dir);
+    fetchMock.mockRejectedValueOnce(new Error('offline'));
+    expect(await fetchTextCached(URL)).toBe('x');
+  });
+
+  test('persists memo tables per namespace', async () => {
+    await savePersistentMemo('find-tz', new Map([['1_2', ['Europe/London']]]), 'geo-tz 8');
+    const same = new Map<string, string[]>();
+    expect(await loadPersistentMemo('find-tz', same, 'geo-tz 8')).toBe(1);
+    expect(same.get('1_2')).toEqual(['Europe/London']);
+    const other = new Map<string, string[]>();
+    expect(await loadPersistentMemo('find-tz', other, 'geo-tz 9')).toBe(0);
+    expect(other.size).toBe(0);
+  });
+
+  test('reports outputs up to date only for the same inputs and untouched files', async () => {
+    const out = path.join(dir, 'out.c');
+    await fs.writeFile(out, 'int x;');
+    const hash = hashInputs({ html: 'h1', top: 10 });
+    expect(hashInputs({ top: 10, html: 'h1' })).toBe(hash);
+
+    await recordOutputs(hash, [out]);
+    expect(await outputsUpToDate(hash, [out])).toBe(true);
+    expect(await outputsUpToDate(hashInputs({ html: 'h2', top: 10 }), [out])).toBe(false);
+    await fs.writeFile(out, 'int y;');
+    expect(await outputsUpToDate(hash, [out])).toBe(false);
+  });
+});
@@ -0,0 +1,202 @@
+import { createHash } from 'crypto';
+import * as fs from 'fs/promises';
+import * as path from 'path';
+
+// ---------------------------------------------------------------------------
+// On-disk cache for generateAirportTzList.ts
+//
+//   http/<sha1(url)>.body|.json  downloads, revalidated with ETag /
+//                                Last-Modified and reused offline
+//   <name>.json                  persisted memo tables (geo-tz lookups, DST
+//                                transitions), tagged with the library and
+//                                tz database versions they were computed with
+//   inputs.json                  hash of every input of the last run plus the
+//                                digests of the files it wrote
+//
+// Nothing is cached until configureGeneratorCache() is given a directory.
+// ---------------------------------------------------------------------------
+
+let cacheDir: string | null = null;
+const fetchedThisRun = new Map<string, string>(); // url -> body
+
+export function configureGeneratorCache(dir: string | null): void {
+    cacheDir = dir;
+    fetchedThisRun.clear();
+}
+
+export function sha256(data: string | Buffer): string {
+    return createHash('sha256').update(data).digest('hex');
+}
+
+/** Version of an installed package, or 'unknown' */
+export function packageVersion(name: string): string {
+    try {
+        return require(`${name}/package.json`).version ?? 'unknown';
+    } catch {
+        return 'unknown';
+    }
+}
+
+async function readOrNull(file: string): Promise<string | null> {
+    try {
+        return await fs.readFile(file, 'utf-8');
+    } catch {
+        return null;
+    }
+}
+
+async function writeAtomic(file: string, data: string): Promise<void> {
+    await fs.mkdir(path.dirname(file), { recursive: true });
+    const tmp = `${file}.${process.pid}.tmp`;
+    await fs.writeFile(tmp, data, 'utf-8');
+    await fs.rename(tmp, file);
+}
+
+// ---------------------------------------------------------------------------
+// HTTP
+// ---------------------------------------------------------------------------
+interface HttpCacheMeta {
+    url: string;
+    etag: string | null;
+    lastModified: string | null;
+    sha256: string;
+}
+
+/**
+ * Fetches `url` as text. With a cache directory the previous body is
+ * revalidated (304 reuses it), and a failed request falls back to it.
+ * Each URL is requested at most once per run.
+ */
+export async function fetchTextCached(url: string): Promise<string> {
+    const seen = fetchedThisRun.get(url);
+    if (seen !== undefined) return seen;
+
+    if (!cacheDir) {
+        const response = await fetch(url);
+        if (!response.ok) throw new Error(`Failed to fetch ${url}: ${response.statusText}`);
+        const text = await response.text();
+        fetchedThisRun.set(url, text);
+        return text;
+    }
+
+    const base = path.join(cacheDir, 'http', createHash('sha1').update(url).digest('hex'));
+    const metaText = await readOrNull(`${base}.json`);
+    const meta: HttpCacheMeta | null = metaText ? JSON.parse(metaText) : null;
+    const cached = meta ? await readOrNull(`${base}.body`) : null;
+    const cachedValid = meta !== null && cached !== null && sha256(cached) === meta.sha256;
+
+    const headers: Record<string, string> = {};
+    if (cachedValid && meta!.etag) headers['If-None-Match'] = meta!.etag;
+    if (cachedValid && meta!.lastModified) headers['If-Modified-Since'] = meta!.lastModified;
+
+    let text: string;
+    try {
+        const response = await fetch(url, { headers });
+        if (response.status === 304 && cachedValid) {
+            console.log(`[cache] ${url} not modified`);
+            text = cached!;
+        } else if (!response.ok) {
+            throw new Error(`Failed to fetch ${url}: ${response.statusText}`);
+        } else {
+            text = await response.text();
+            const fresh: HttpCacheMeta = {
+                url,
+                etag: response.headers?.get('etag') ?? null,
+                lastModified: response.headers?.get('last-modified') ?? null,
+                sha256: sha256(text),
+            };
+            await writeAtomic(`${base}.body`, text);
+            await writeAtomic(`${base}.json`, JSON.stringify(fresh, null, 2));
+            console.log(`[cache] ${url} downloaded (${text.length} bytes)`);
+        }
+    } catch (error) {
+        if (!cachedValid) throw error;
+        console.warn(`[cache] ${url} unreachable, using the cached copy:`, (error as Error).message);
+        text = cached!;
+    }
+    fetchedThisRun.set(url, text);
+    return text;
+}
+
+// ---------------------------------------------------------------------------
+// Persisted memo tables
+// ---------------------------------------------------------------------------
+interface MemoFile<V> {
+    namespace: string;
+    entries: Array<[string, V]>;
+}
+
+/**
+ * Fills `map` from <cache>/<name>.json if it was written under the same
+ * `namespace` (library/tzdata versions). Returns the number of entries read.
+ */
+export async function loadPersistentMemo<V>(name: string, map: Map<string, V>, namespace: string): Promise<number> {
+    if (!cacheDir) return 0;
+    const text = await readOrNull(path.join(cacheDir, `${name}.json`));
+    if (!text) return 0;
+    try {
+        const file: MemoFile<V> = JSON.parse(text);
+        if (file.namespace !== namespace) {
+            console.log(`[cache] ${name}: computed with ${file.namespace}, now ${namespace}; starting over`);
+            return 0;
+        }
+        for (const [key, value] of file.entries) map.set(key, value);
+        return file.entries.length;
+    } catch {
+        return 0;
+    }
+}
+
+export async function savePersistentMemo<V>(name: string, map: Map<string, V>, namespace: string): Promise<void> {
+    if (!cacheDir) return;
+    const file: MemoFile<V> = { namespace, entries: Array.from(map.entries()) };
+    await writeAtomic(path.join(cacheDir, `${name}.json`), JSON.stringify(file));
+}
+
+// ---------------------------------------------------------------------------
+// Input hash / up-to-date check
+// ---------------------------------------------------------------------------
+export type InputParts = Record<string, string | number | boolean | null>;
+
+/** Order-independent hash of named input digests and options */
+export function hashInputs(parts: InputParts): string {
+    const keys = Object.keys(parts).sort();
+    return sha256(JSON.stringify(keys.map(k => [k, parts[k]])));
+}
+
+export async function fileDigest(file: string): Promise<string | null> {
+    try {
+        return sha256(await fs.readFile(file));
+    } catch {
+        return null;
+    }
+}
+
+interface InputsStamp {
+    inputHash: string;
+    outputs: Record<string, string>;
+}
+
+/** True if the last run had the same inputs and its outputs are untouched */
+export async function outputsUpToDate(inputHash: string, outputs: string[]): Promise<boolean> {
+    if (!cacheDir) return false;
+    const text = await readOrNull(path.join(cacheDir, 'inputs.json'));
+    if (!text) return false;
+    const stamp: InputsStamp = JSON.parse(text);
+    if (stamp.inputHash !== inputHash) return false;
+    for (const out of outputs) {
+        const digest = await fileDigest(out);
+        if (digest === null || stamp.outputs[path.resolve(out)] !== digest) return false;
+    }
+    return true;
+}
+
+export async function recordOutputs(inputHash: string, outputs: string[]): Promise<void> {
+    if (!cacheDir) return;
+    const stamp: InputsStamp = { inputHash, outputs: {} };
+    for (const out of outputs) {
+        const digest = await fileDigest(out);
+        if (digest !== null) stamp.outputs[path.resolve(out)] = digest;
+    }
+    await writeAtomic(path.join(cacheDir, 'inputs.json'), JSON.stringify(stamp, null, 2));
+}
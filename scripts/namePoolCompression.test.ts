@@ -0,0 +1,53 @@
+import { compressNamePool, decodeName, MAX_CODE_BITS } from './namePoolCompression';
+
+describe('namePoolCompression', () => {
+  const names = [
+    'Los Angeles',
+    'San Francisco',
+    'San Diego',
+    'General Abelardo L. Rodríguez',
+    'Chicago O\'Hare',
+    'A',
+  ];
+
+  test('round-trips every name through the reference decoder', () => {
+    const pool = compressNamePool(names);
+    names.forEach((name, i) => expect(decodeName(pool, i)).toBe(name));
+  });
+
+  test('is smaller than the plain pool and reports sizes', () => {
+    const pool = compressNamePool(names);
+    const rawBytes = names.reduce((sum, n) => sum + Buffer.byteLength(n, 'utf8') + 1, 0);
+    expect(pool.rawBytes).toBe(rawBytes);
+    expect(pool.bits.length).toBeLessThan(rawBytes);
+    expect(pool.maxNameBytes).toBe(Buffer.byteLength('General Abelardo L. Rodríguez', 'utf8'));
+  });
+
+  test('emits a valid canonical code within the decoder limit', () => {
+    const pool = compressNamePool(names);
+    expect(pool.maxBits).toBeLessThanOrEqual(MAX_CODE_BITS);
+    // Kraft equality holds for a complete prefix code
+    const kraft = pool.counts.reduce((sum, c, len) => sum + (len > 0 ? c / 2 ** len : 0), 0);
+    expect(kraft).toBeCloseTo(1);
+    expect(pool.counts.reduce((a, b) => a + b, 0)).toBe(pool.symbols.length);
+  });
+
+  test('limits code lengths on skewed input', () => {
+    // Fibonacci-like weights force a deep tree without length limiting
+    let a = 1, b = 1;
+    const skewed: string[] = [];
+    for (let i = 0; i < 20; i++) {
+      skewed.push(String.fromCharCode(65 + i).repeat(a));
+      [a, b] = [b, a + b];
+    }
+    const pool = compressNamePool(skewed);
+    expect(pool.maxBits).toBeLessThanOrEqual(MAX_CODE_BITS);
+    skewed.forEach((name, i) => expect(decodeName(pool, i)).toBe(name));
+  });
+
+  test('handles an empty pool', () => {
+    const pool = compressNamePool([]);
+    expect(pool.bits).toEqual([]);
+    expect(pool.compressedBytes).toBe(0);
+  });
+});
@@ -0,0 +1,135 @@
+// ---------------------------------------------------------------------------
+// Airport name pool compression
+//
+// Static canonical Huffman code over the bytes of all names, with the NUL
+// terminator as an ordinary symbol. Every name starts at a bit offset in one
+// MSB-first bitstream, so the watch decodes only the name it needs by reading
+// symbols until it hits NUL. The code is described by the number of codes per
+// length plus the symbols in canonical order (the "puff" layout), which keeps
+// both the tables and the decoder tiny.
+// ---------------------------------------------------------------------------
+
+/** Longest code the C decoder accepts; keeps the count table small. */
+export const MAX_CODE_BITS = 15;
+
+export interface CompressedNamePool {
+    counts: number[];      // counts[len] = number of codes of that length, len 0..maxBits
+    symbols: number[];     // Symbols in canonical order
+    bits: number[];        // Bitstream bytes, MSB first
+    bitOffsets: number[];  // Bit offset of every name in `bits`
+    maxBits: number;       // Longest code length in use
+    rawBytes: number;      // Plain pool: names + NULs
+    compressedBytes: number; // Bitstream + code tables
+    maxNameBytes: number;  // Longest decoded name, for sizing the scratch buffer
+}
+
+/**
+ * Huffman code lengths for the given symbol weights. Ties are broken by
+ * creation order, so the result is deterministic for a given input.
+ */
+function huffmanLengths(weights: Map<number, number>): Map<number, number> {
+    type Node = { weight: number; id: number; symbols: number[] };
+    let nextId = 0;
+    let nodes: Node[] = Array.from(weights.entries())
+        .sort((a, b) => a[0] - b[0])
+        .map(([symbol, weight]) => ({ weight, id: nextId++, symbols: [symbol] }));
+    const lengths = new Map<number, number>();
+    for (const node of nodes) lengths.set(node.symbols[0], 0);
+    if (nodes.length === 1) {
+        lengths.set(nodes[0].symbols[0], 1);
+        return lengths;
+    }
+    while (nodes.length > 1) {
+        nodes.sort((a, b) => a.weight - b.weight || a.id - b.id);
+        const [lo, hi] = nodes.splice(0, 2);
+        for (const s of lo.symbols.concat(hi.symbols)) lengths.set(s, lengths.get(s)! + 1);
+        nodes.push({ weight: lo.weight + hi.weight, id: nextId++, symbols: lo.symbols.concat(hi.symbols) });
+    }
+    return lengths;
+}
+
+/** Compresses the names; each name is encoded with a trailing NUL symbol. */
+export function compressNamePool(rawNames: string[]): CompressedNamePool {
+    const names = rawNames.map(n => Array.from(Buffer.from(n, 'utf8')));
+    for (const name of names) {
+        if (name.includes(0)) throw new Error('Airport names must not contain NUL bytes');
+    }
+    const rawBytes = names.reduce((sum, n) => sum + n.length + 1, 0);
+    const maxNameBytes = names.reduce((max, n) => Math.max(max, n.length), 0);
+
+    if (names.length === 0) {
+        return { counts: [0], symbols: [], bits: [], bitOffsets: [], maxBits: 0, rawBytes, compressedBytes: 0, maxNameBytes };
+    }
+
+    const weights = new Map<number, number>();
+    for (const name of names) {
+        for (const b of name.concat([0])) weights.set(b, (weights.get(b) ?? 0) + 1);
+    }
+
+    // Halve the weights until the code fits the decoder's length limit
+    let lengths = huffmanLengths(weights);
+    while (Math.max(...lengths.values()) > MAX_CODE_BITS) {
+        for (const [s, w] of weights) weights.set(s, (w + 1) >> 1);
+        lengths = huffmanLengths(weights);
+    }
+    const maxBits = Math.max(...lengths.values());
+
+    // Canonical assignment: ordered by (length, symbol value)
+    const symbols = Array.from(lengths.keys()).sort((a, b) => lengths.get(a)! - lengths.get(b)! || a - b);
+    const counts = new Array(maxBits + 1).fill(0);
+    for (const s of symbols) counts[lengths.get(s)!]++;
+    const codes = new Map<number, number>();
+    let code = 0;
+    let prevLen = 0;
+    for (const s of symbols) {
+        const len = lengths.get(s)!;
+        code <<= len - prevLen;
+        codes.set(s, code++);
+        prevLen = len;
+    }
+
+    const bits: number[] = [];
+    const bitOffsets: number[] = [];
+    let bitPos = 0;
+    const put = (value: number, len: number) => {
+        for (let i = len - 1; i >= 0; i--) {
+            if ((bitPos & 7) === 0) bits.push(0);
+            if ((value >> i) & 1) bits[bits.length - 1] |= 0x80 >> (bitPos & 7);
+            bitPos++;
+        }
+    };
+    for (const name of names) {
+        bitOffsets.push(bitPos);
+        for (const b of name.concat([0])) put(codes.get(b)!, lengths.get(b)!);
+    }
+
+    const compressedBytes = bits.length + counts.length + symbols.length;
+    return { counts, symbols, bits, bitOffsets, maxBits, rawBytes, compressedBytes, maxNameBytes };
+}
+
+/** Reference decoder, mirrors _airport_flat_name() on the watch. */
+export function decodeName(pool: CompressedNamePool, index: number): string {
+    const out: number[] = [];
+    let bitPos = pool.bitOffsets[index];
+    for (;;) {
+        let code = 0;
+        let first = 0;
+        let symbolIndex = 0;
+        let symbol = -1;
+        for (let len = 1; len <= pool.maxBits; len++) {
+            code |= (pool.bits[bitPos >> 3] >> (7 - (bitPos & 7))) & 1;
+            bitPos++;
+            const count = pool.counts[len];
+            if (code - first < count) {
+                symbol = pool.symbols[symbolIndex + code - first];
+                break;
+            }
+            symbolIndex += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        if (symbol <= 0) break;
+        out.push(symbol);
+    }
+    return Buffer.from(out).toString('utf8');
+}
@@ -0,0 +1,34 @@
+import path from 'path';
+import fs from 'fs';
+import { bucketTableChecksum, formatPhoneBuckets, phoneBucketTable } from './phoneSchedule';
+
+describe('phoneSchedule', () => {
+  const buckets = [
+    { zone: 'America/Los_Angeles', stdQuarters: -32, dstQuarters: -28 },
+    { zone: 'Europe/London', stdQuarters: 0, dstQuarters: 4 },
+  ];
+
+  test('checksums zones and offsets in table order', () => {
+    const checksum = bucketTableChecksum(buckets);
+    expect(checksum).toBeGreaterThan(0);
+    expect(checksum).toBeLessThanOrEqual(0xffffffff);
+    expect(bucketTableChecksum([...buckets].reverse())).not.toBe(checksum);
+    expect(bucketTableChecksum([{ ...buckets[0], dstQuarters: -32 }, buckets[1]])).not.toBe(checksum);
+  });
+
+  test('lists one zone per bucket and round-trips through JSON', () => {
+    const table = phoneBucketTable('full', buckets);
+    expect(table.zones).toEqual(['America/Los_Angeles', 'Europe/London']);
+    expect(JSON.parse(formatPhoneBuckets([table]))).toEqual({ tables: [table] });
+  });
+
+  test('the checked-in phone table matches the checked-in C data', () => {
+    const c = fs.readFileSync(path.join(__dirname, '../src/c/airport_tz_list.c'), 'utf-8');
+    const json = JSON.parse(fs.readFileSync(path.join(__dirname, '../src/pkjs/airport_buckets.json'), 'utf-8'));
+    const checksum = parseInt(c.match(/#define AIRPORT_DATA_CHECKSUM 0x([0-9a-f]+)u/)![1], 16);
+    const count = parseInt(c.match(/#define AIRPORT_TZ_LIST_COUNT (\d+)/)![1], 10);
+    const table = json.tables.find((t: { checksum: number }) => t.checksum === checksum);
+    expect(table).toBeDefined();
+    expect(table.zones).toHaveLength(count);
+  });
+});
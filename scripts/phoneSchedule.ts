@@ -0,0 +1,48 @@
+import * as fs from 'fs/promises';
+
+// ---------------------------------------------------------------------------
+// Bucket tables for the phone schedule
+//
+// src/pkjs/schedule.js computes the hero pick of every :00/:15/:30 slot on the
+// phone, from the phone's own tz database, and the watch uses those picks
+// instead of its DST table while they are fresh.  For that the phone needs
+// every variant's buckets in table order, as one representative zone each;
+// the checksum ties a table to the C variant it was generated with
+// (AIRPORT_DATA_CHECKSUM), so a watch never applies picks made for other data.
+// ---------------------------------------------------------------------------
+
+export interface ScheduleBucket {
+    zone: string;         // representative zone, the one the DST events come from
+    stdQuarters: number;
+    dstQuarters: number;
+}
+
+export interface PhoneBucketTable {
+    tier: string;
+    checksum: number;     // AIRPORT_DATA_CHECKSUM of the variant
+    zones: string[];      // one per bucket, in table order
+}
+
+/** 32-bit FNV-1a over the zone and offsets of every bucket; never 0 (0 = no schedules) */
+export function bucketTableChecksum(buckets: ScheduleBucket[]): number {
+    let hash = 0x811c9dc5;
+    for (const b of buckets) {
+        for (const byte of Buffer.from(`${b.zone} ${b.stdQuarters} ${b.dstQuarters}\n`, 'utf8')) {
+            hash = Math.imul(hash ^ byte, 0x01000193) >>> 0;
+        }
+    }
+    return hash || 1;
+}
+
+export function phoneBucketTable(tier: string, buckets: ScheduleBucket[]): PhoneBucketTable {
+    return { tier, checksum: bucketTableChecksum(buckets), zones: buckets.map(b => b.zone) };
+}
+
+export function formatPhoneBuckets(tables: PhoneBucketTable[]): string {
+    const lines = tables.map(t => `    ${JSON.stringify(t)}`);
+    return `{\n  "tables": [\n${lines.join(',\n')}\n  ]\n}\n`;
+}
+
+export async function writePhoneBuckets(file: string, tables: PhoneBucketTable[]): Promise<void> {
+    await fs.writeFile(file, formatPhoneBuckets(tables), 'utf-8');
+}
@@ -0,0 +1,58 @@
+// decodeProfile() in src/pkjs/profile.js against ProfileSummary bytes laid
+// out as src/c/profiler.h packs them (little-endian, 52 bytes)
+import fs from 'fs';
+import path from 'path';
+const { PROFILE_FIELD_NAMES, decodeProfile } = require('../src/pkjs/profile');
+
+// ProfileField order in src/c/profiler.h
+const FIELD = { code: 0, name: 1, time: 2, strip: 3, tid: 4, beat: 5 };
+
+function summaryBytes(redraws: Partial<Record<keyof typeof FIELD, number>>): number[] {
+  const bytes: number[] = [];
+  const u8 = (v: number) => bytes.push(v & 0xff);
+  const u16 = (v: number) => { u8(v); u8(v >> 8); };
+  const u32 = (v: number) => { u16(v & 0xffff); u16(v >>> 16); };
+  u8(3); u8(8); u16(15);            // version, field_count, window_minutes
+  u32(900); u32(1800); u16(12);     // ticks, tick_total_ms, tick_max_ms
+  u16(3); u16(40); u16(450);        // reeval_count, reeval_max_ms, frames
+  u32(9000); u32(9400); u32(70000); // heap_free_min, heap_free_max, heap_used_max
+  u16(420); u16(2100);              // message_heap, message_reclaimed
+  const counts = new Array(8).fill(0);
+  for (const [name, count] of Object.entries(redraws)) counts[FIELD[name as keyof typeof FIELD]] = count;
+  counts.forEach(u16);
+  return bytes;
+}
+
+describe('decodeProfile', () => {
+  test('names the fields in ProfileField order', () => {
+    const header = fs.readFileSync(path.join(__dirname, '../src/c/profiler.h'), 'utf-8');
+    const body = header.match(/typedef enum \{([^}]*)\} ProfileField;/)![1];
+    const fields = [...body.matchAll(/PROFILE_FIELD_(\w+)/g)].map(m => m[1].toLowerCase())
+                                                          .filter(name => name !== 'count');
+    expect(fields).toEqual(PROFILE_FIELD_NAMES);
+    expect(Object.keys(FIELD)).toEqual(PROFILE_FIELD_NAMES);
+  });
+
+  test('decodes every field of a v3 summary', () => {
+    const bytes = summaryBytes({ code: 1, name: 1, time: 900, tid: 900, beat: 104 });
+    expect(bytes).toHaveLength(52);
+    expect(decodeProfile(bytes)).toMatchObject({
+      version: 3, windowMinutes: 15, ticks: 900, tickTotalMs: 1800, tickMaxMs: 12, reevalCount: 3,
+      reevalMaxMs: 40, frames: 450, heapFreeMin: 9000, heapFreeMax: 9400, heapUsedMax: 70000,
+      messageHeap: 420, messageReclaimed: 2100, tickAvgMs: 2,
+      redraws: { code: 1, name: 1, time: 900, tid: 900, beat: 104 },
+    });
+  });
+
+  test('keeps .beat redraws under their name in a build without TID', () => {
+    // TIDFACE_CLOCKS=beat: no TID field, the beat field still reports as PROFILE_FIELD_BEAT
+    const summary = decodeProfile(summaryBytes({ code: 1, name: 1, time: 900, beat: 104 }));
+    expect(summary.redraws).toEqual({ code: 1, name: 1, time: 900, beat: 104 });
+  });
+
+  test('rejects other summary versions', () => {
+    const bytes = summaryBytes({});
+    bytes[0] = 2;
+    expect(decodeProfile(bytes)).toBeNull();
+  });
+});
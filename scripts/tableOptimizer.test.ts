@@ -0,0 +1,47 @@
+import { type TableCandidate, coverageFrontier, formatTableSearch, optimizeTableParams, tableBytes } from './tableOptimizer';
+
+describe('tableOptimizer', () => {
+  // Coverage grows with both parameters and levels off at group 4, bucket 3;
+  // every airport costs 20 bytes and every pair has 10 buckets
+  const evaluate = (groupSize: number, maxBucket: number): TableCandidate => {
+    const airports = Math.min(groupSize, 4) * Math.min(maxBucket, 3) + groupSize;
+    return {
+      groupSize, maxBucket, airports,
+      codeBytes: airports * 2, nameBytes: airports * 18, bucketBytes: 32,
+      zones: Math.min(groupSize, 4) * Math.min(maxBucket, 3),
+      coverage: Math.min(groupSize, 4) * Math.min(maxBucket, 3) / 12,
+      routeHits: airports * 100,
+    };
+  };
+  const search = { groupSizes: [1, 2, 3, 4, 5, 6], maxBuckets: [1, 2, 3, 4, 5] };
+
+  test('picks the best coverage that fits, then the most route hits', () => {
+    const result = optimizeTableParams(evaluate, 32 + 16 * 20, search);
+    expect(result.evaluated).toBe(30);
+    expect(result.best).toMatchObject({ groupSize: 4, maxBucket: 3, coverage: 1 });
+    expect(tableBytes(result.best!)).toBeLessThanOrEqual(result.budgetBytes);
+  });
+
+  test('settles for less coverage under a tight budget and reports when nothing fits', () => {
+    const tight = optimizeTableParams(evaluate, 32 + 6 * 20, search);
+    expect(tight.best).toMatchObject({ groupSize: 2, maxBucket: 2 });
+    expect(optimizeTableParams(evaluate, 40, search).best).toBeNull();
+  });
+
+  test('keeps only candidates that buy coverage with their bytes', () => {
+    const frontier = coverageFrontier(search.groupSizes.flatMap(g => search.maxBuckets.map(m => evaluate(g, m))));
+    for (let i = 1; i < frontier.length; i++) {
+      expect(tableBytes(frontier[i])).toBeGreaterThan(tableBytes(frontier[i - 1]));
+      expect(frontier[i].coverage).toBeGreaterThanOrEqual(frontier[i - 1].coverage);
+    }
+    expect(frontier[frontier.length - 1].coverage).toBe(1);
+    expect(frontier.some(c => c.groupSize > 4)).toBe(false);
+  });
+
+  test('marks the pick in the report', () => {
+    const report = formatTableSearch('compact', optimizeTableParams(evaluate, 32 + 16 * 20, search)).split('\n');
+    expect(report[0]).toBe('Table search for compact: budget 352 B, 30 pairs, groupSize 4, maxBucket 3 (352 B)');
+    expect(report.filter(line => line.startsWith('*'))).toHaveLength(1);
+    expect(report.find(line => line.startsWith('*'))).toMatch(/^\*\s+4\s+3\s+16\s+12\s+100\.0%/);
+  });
+});
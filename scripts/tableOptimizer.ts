@@ -0,0 +1,97 @@
+// ---------------------------------------------------------------------------
+// groupSize/maxBucket search against a byte budget
+//
+// A data tier's groupSize (airports per std offset from the HTML list) and
+// maxBucket (airports per DST bucket) trade airports for bytes.  With
+// --optimize the generator evaluates every pair in a grid, keeps those whose
+// code pool, name pool and bucket table fit the tier's budgetBytes, and
+// picks the one with the best coverage: the zones that show at least one
+// airport, each weighted by the route_hits of its airports, then the
+// route_hits of the airports carried, then the fewest bytes.  Evaluation is
+// left to the caller, so this module only ranks and reports.
+// ---------------------------------------------------------------------------
+
+/** One evaluated groupSize/maxBucket pair */
+export interface TableCandidate {
+    groupSize: number;
+    maxBucket: number;
+    codeBytes: number;    // code pool
+    nameBytes: number;    // name pool and its index
+    bucketBytes: number;  // bucket table
+    airports: number;
+    zones: number;        // distinct zones with at least one airport
+    coverage: number;     // route-weighted share of all zones represented, 0..1
+    routeHits: number;    // route_hits summed over the airports carried
+}
+
+export interface TableSearchRange {
+    groupSizes: number[];
+    maxBuckets: number[];
+}
+
+export interface TableSearchResult {
+    budgetBytes: number;
+    best: TableCandidate | null;   // null if nothing fits
+    frontier: TableCandidate[];    // coverage vs. bytes, non-dominated, by size
+    evaluated: number;
+}
+
+const range = (from: number, to: number): number[] => Array.from({ length: to - from + 1 }, (_, i) => from + i);
+
+export const DEFAULT_TABLE_SEARCH: TableSearchRange = { groupSizes: range(1, 20), maxBuckets: range(1, 20) };
+
+export function tableBytes(c: TableCandidate): number {
+    return c.codeBytes + c.nameBytes + c.bucketBytes;
+}
+
+/** Negative if `a` is the better pick */
+export function compareCandidates(a: TableCandidate, b: TableCandidate): number {
+    return (b.coverage - a.coverage) || (b.routeHits - a.routeHits) || (tableBytes(a) - tableBytes(b)) ||
+           (a.groupSize - b.groupSize) || (a.maxBucket - b.maxBucket);
+}
+
+/** Candidates no other one beats on coverage without costing more, smallest first */
+export function coverageFrontier(candidates: TableCandidate[]): TableCandidate[] {
+    const bySize = [...candidates].sort((a, b) => (tableBytes(a) - tableBytes(b)) || compareCandidates(a, b));
+    const frontier: TableCandidate[] = [];
+    for (const c of bySize) {
+        if (frontier.length === 0 || c.coverage > frontier[frontier.length - 1].coverage) frontier.push(c);
+    }
+    return frontier;
+}
+
+export function optimizeTableParams(evaluate: (groupSize: number, maxBucket: number) => TableCandidate,
+                                    budgetBytes: number,
+                                    search: TableSearchRange = DEFAULT_TABLE_SEARCH): TableSearchResult {
+    const candidates: TableCandidate[] = [];
+    for (const groupSize of search.groupSizes) {
+        for (const maxBucket of search.maxBuckets) candidates.push(evaluate(groupSize, maxBucket));
+    }
+    const fitting = candidates.filter(c => tableBytes(c) <= budgetBytes);
+    fitting.sort(compareCandidates);
+    return { budgetBytes, best: fitting[0] ?? null, frontier: coverageFrontier(candidates), evaluated: candidates.length };
+}
+
+/** Coverage against bytes along the frontier: '*' marks the pick, '>' the rows over budget */
+export function formatTableSearch(tier: string, result: TableSearchResult): string {
+    const rows = [['', 'group', 'bucket', 'airports', 'zones', 'coverage', 'codes', 'names', 'buckets', 'total']];
+    const best = result.best;
+    const shown = best && !result.frontier.includes(best)
+        ? [...result.frontier, best].sort((a, b) => tableBytes(a) - tableBytes(b))
+        : result.frontier;
+    for (const c of shown) {
+        const picked = c === best;
+        rows.push([picked ? '*' : tableBytes(c) > result.budgetBytes ? '>' : '',
+                   String(c.groupSize), String(c.maxBucket), String(c.airports), String(c.zones),
+                   `${(c.coverage * 100).toFixed(1)}%`, `${c.codeBytes} B`, `${c.nameBytes} B`,
+                   `${c.bucketBytes} B`, `${tableBytes(c)} B`]);
+    }
+    const widths = rows[0].map((_, col) => Math.max(...rows.map(r => r[col].length)));
+    const table = rows.map(r => r.map((cell, col) => col === 0 ? cell.padEnd(widths[col]) : cell.padStart(widths[col]))
+                                 .join('  ').trimEnd());
+    const pick = best
+        ? `groupSize ${best.groupSize}, maxBucket ${best.maxBucket} (${tableBytes(best)} B)`
+        : 'nothing fits';
+    return [`Table search for ${tier}: budget ${result.budgetBytes} B, ${result.evaluated} pairs, ${pick}`, ...table]
+        .join('\n');
+}
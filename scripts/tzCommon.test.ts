@@ -1,4 +1,4 @@
-import { findDstTransitions, DstTransitions } from './tzCommon';
+import { findDstTransitions, findDstTransitionsByWalk, DstTransitions } from './tzCommon';
 
 // Generated for year 2025 by generateExpectedTransitions.ts
 const expectedTransitions: { zone: string; expected: DstTransitions }[] = [
@@ -64,5 +64,19 @@ describe('tzCommon', () => {
       const result2 = findDstTransitions(zone, year);
       expect(result1).toEqual(result2);
     });
+
+    // The offset-timeline fast path must reproduce the Luxon walk exactly,
+    // including zones with odd rules (Ramadan pauses, 30-minute DST, southern
+    // hemisphere, rule changes inside the table years)
+    const awkwardZones = [
+      'America/Santiago', 'Africa/Casablanca', 'Asia/Gaza', 'America/St_Johns', 'Africa/Cairo',
+      'Asia/Tehran', 'Europe/Chisinau', 'America/Godthab', 'Australia/Lord_Howe', 'Pacific/Auckland',
+      'America/Asuncion', 'Pacific/Chatham', 'Antarctica/Troll', 'Europe/Dublin', 'UTC',
+    ];
+    test.each(awkwardZones)('matches the Luxon walk for %s in 2025-2035', (zone) => {
+      for (let y = 2025; y <= 2035; y++) {
+        expect(findDstTransitions(zone, y)).toEqual(findDstTransitionsByWalk(zone, y));
+      }
+    });
   });
 }); 
@@ -5,6 +5,7 @@ import { IANAZone } from 'luxon';
  * Cache for findDstTransitions results. Key: "zoneName:year"
  */
 const transitionCache = new Map<string, DstTransitions>();
+const walkCache = new Map<string, DstTransitions>();
 
 /**
  * Type definition for the return value of findDstTransitions.
@@ -48,46 +49,29 @@ function getTzDetails(zoneName: string, dt: DateTime): TzDetails | undefined {
   return { offsetSeconds, isDST };
 }
 
-/**
- * Return [std_offset_sec, dst_offset_sec, dst_start_utc_ts, dst_end_utc_ts].
- * If the zone does not observe DST, std == dst and transition timestamps are 0.
- * Caches results per zone/year combination.
- */
-export function findDstTransitions(zoneName: string, year: number): DstTransitions {
-  const cacheKey = `${zoneName}:${year}`;
-  if (transitionCache.has(cacheKey)) {
-    return transitionCache.get(cacheKey)!;
-  }
+/** (offset, isDST) of a zone at an epoch second, or undefined if unknown */
+type DetailsAt = (ts: number) => TzDetails | undefined;
 
-  // Validate zone early
-  if (!IANAZone.isValidZone(zoneName)) {
-    return [0, 0, 0, 0];
-  }
-
-  /*
-   * Optimised algorithm
-   * -------------------
-   * 1. Walk through the year in STEP_HOURS chunks (default 6h) instead of hour-by-hour.
-   * 2. When we detect a DST state change between two checkpoints we perform a binary
-   *    search down to *hour* granularity to locate the transition start hour.  This
-   *    guarantees the **same output** as the previous naive hour-by-hour loop while
-   *    reducing the worst-case iterations by ~6× (1460 vs 8760 for a non-leap year).
-   * 3. We collect the first STD→DST transition (startTs) and the first DST→STD
-   *    transition (endTs) that occur **inside the target year**.
-   */
+const HOUR_SECONDS = 3600;
 
-  const STEP_HOURS = 6; // coarse step, must be power-of-two divisor of 24.
-  const startOfYear = DateTime.utc(year, 1, 1);
-  const startCursor = startOfYear.minus({ hours: 1 }); // one hour before the year
-  const endBoundary = DateTime.utc(year + 1, 1, 1).plus({ hours: 2 }); // small buffer
+/**
+ * The transition walk shared by both paths, over epoch seconds:
+ * 1. Walk through the year in STEP_HOURS chunks (default 6h) instead of hour-by-hour.
+ * 2. When we detect a DST state change between two checkpoints we perform a binary
+ *    search down to *hour* granularity to locate the transition start hour.  This
+ *    guarantees the **same output** as the previous naive hour-by-hour loop while
+ *    reducing the worst-case iterations by ~6× (1460 vs 8760 for a non-leap year).
+ * 3. We collect the last STD→DST transition (startTs) and the last DST→STD
+ *    transition (endTs) that occur **inside the target year**.
+ * `detailsAt` must be defined at the start of the walk.
+ */
+function walkDstTransitions(year: number, detailsAt: DetailsAt): DstTransitions {
+  const STEP_SECONDS = 6 * HOUR_SECONDS; // coarse step, must be power-of-two divisor of 24h.
+  const startCursor = Date.UTC(year, 0, 1) / 1000 - HOUR_SECONDS; // one hour before the year
+  const endBoundary = Date.UTC(year + 1, 0, 1) / 1000 + 2 * HOUR_SECONDS; // small buffer
 
   let cursor = startCursor;
-  const firstDetails = getTzDetails(zoneName, cursor);
-  if (!firstDetails) {
-    // Should never happen for valid zones but keep behaviour consistent.
-    return [0, 0, 0, 0];
-  }
-
+  const firstDetails = detailsAt(cursor)!;
   let prevIsDST = firstDetails.isDST;
   let prevOffsetSec = firstDetails.offsetSeconds;
 
@@ -98,33 +82,27 @@ export function findDstTransitions(zoneName: string, year: number): DstTransitio
   let startTs = 0;
   let endTs = 0;
 
-  // Helper: binary search between two datetimes (inclusive lower, exclusive upper)
+  // Helper: binary search between two instants (inclusive lower, exclusive upper)
   // to find the *first* hour whose DST flag differs from the lower bound.
-  const refineTransitionHour = (
-    lower: DateTime,
-    upper: DateTime,
-    lowerIsDST: boolean,
-  ): DateTime => {
-    // Ensure bounds differ in DST state
+  const refineTransitionHour = (lower: number, upper: number, lowerIsDST: boolean): number => {
     let low = lower;
     let high = upper;
-    while (high.diff(low, 'hours').hours > 1) {
-      const mid = low.plus({ milliseconds: high.diff(low).as('milliseconds') / 2 });
-      const midDetails = getTzDetails(zoneName, mid) as TzDetails; // assume valid
-      if (midDetails.isDST === lowerIsDST) {
+    while (high - low > HOUR_SECONDS) {
+      const mid = low + (high - low) / 2;
+      if (detailsAt(mid)!.isDST === lowerIsDST) {
         low = mid;
       } else {
         high = mid;
       }
     }
     // `high` is now within the first hour of the new DST state
-    return high.startOf('hour');
+    return Math.floor(high / HOUR_SECONDS) * HOUR_SECONDS;
   };
 
   // Coarse walk across the year
   while (cursor <= endBoundary) {
-    const nextCursor = cursor.plus({ hours: STEP_HOURS });
-    const details = getTzDetails(zoneName, nextCursor);
+    const nextCursor = cursor + STEP_SECONDS;
+    const details = detailsAt(nextCursor);
     if (!details) {
       // On theoretically invalid zones continue (should not happen)
       cursor = nextCursor;
@@ -144,18 +122,14 @@ export function findDstTransitions(zoneName: string, year: number): DstTransitio
     // Detect toggle between prev and current checkpoints
     if (curIsDST !== prevIsDST) {
       // Refine to hour-precision between cursor and nextCursor
-      const transitionHour = refineTransitionHour(cursor, nextCursor, prevIsDST);
-      const transitionTs = Math.floor(transitionHour.toMillis() / 1000);
+      const transitionTs = refineTransitionHour(cursor, nextCursor, prevIsDST);
+      const inYear = new Date(transitionTs * 1000).getUTCFullYear() === year;
 
       // Determine direction and assign start/end if the transition sits in target year
       if (!prevIsDST && curIsDST) {
-        if (transitionHour.year === year) {
-          startTs = transitionTs; // first second OF new hour when DST begins
-        }
+        if (inYear) startTs = transitionTs; // first second OF new hour when DST begins
       } else if (prevIsDST && !curIsDST) {
-        if (transitionHour.year === year) {
-          endTs = transitionTs; // first second OF new hour when DST ends
-        }
+        if (inYear) endTs = transitionTs; // first second OF new hour when DST ends
       }
 
       // Update prevIsDST to new state for subsequent iterations
@@ -163,7 +137,7 @@ export function findDstTransitions(zoneName: string, year: number): DstTransitio
       prevOffsetSec = curOffsetSec;
 
       // Move cursor forward to just after the transition to avoid re-detecting same one
-      cursor = transitionHour.plus({ hours: 1 });
+      cursor = transitionTs + HOUR_SECONDS;
       continue;
     }
 
@@ -194,7 +168,205 @@ export function findDstTransitions(zoneName: string, year: number): DstTransitio
     endTs = 0;
   }
 
-  const result: DstTransitions = [stdOffsetSec, dstOffsetSec, startTs, endTs];
+  return [stdOffsetSec, dstOffsetSec, startTs, endTs];
+}
+
+// ---------------------------------------------------------------------------
+// Fast path: offset timelines
+//
+// Luxon's isInDST compares the offset of an instant with the offsets of the
+// same wall time on Jan 1 and in May of its local year.  Once the instants at
+// which a zone's offset changes are known, that flag is a lookup, so the walk
+// above can run on a timeline instead of thousands of Luxon DateTimes.  The
+// changes are found with one cached Intl formatter: a probe per day, then a
+// bisection to the second wherever two probes differ.  Each zone's timeline
+// is built once for every year asked of it.
+//
+// Only zones whose Jan 1 and May offsets are steady (no change within a day
+// of Jan 1, none from late April to early June) take the fast path; anything
+// else, or any disagreement with Luxon at the instants that decide the result,
+// falls back to the Luxon walk.
+// ---------------------------------------------------------------------------
+
+const DAY_SECONDS = 24 * HOUR_SECONDS;
+
+interface OffsetTimeline {
+  from: number;
+  to: number;
+  initial: number;        // offset at `from`
+  changes: number[];      // instants the offset changes, ascending
+  offsets: number[];      // offset from changes[i] on
+}
+
+const timelines = new Map<string, OffsetTimeline>();
+const offsetFormats = new Map<string, Intl.DateTimeFormat>();
+let fastPathCount = 0;
+let walkFallbackCount = 0;
+
+/** UTC offset in seconds of `zoneName` at epoch second `ts`, from Intl */
+function intlOffsetSeconds(zoneName: string, ts: number): number {
+  let format = offsetFormats.get(zoneName);
+  if (!format) {
+    format = new Intl.DateTimeFormat('en-US', {
+      timeZone: zoneName, hourCycle: 'h23',
+      year: 'numeric', month: 'numeric', day: 'numeric',
+      hour: 'numeric', minute: 'numeric', second: 'numeric',
+    });
+    offsetFormats.set(zoneName, format);
+  }
+  const parts: Record<string, number> = {};
+  for (const part of format.formatToParts(new Date(ts * 1000))) parts[part.type] = Number(part.value);
+  return Date.UTC(parts.year, parts.month - 1, parts.day, parts.hour, parts.minute, parts.second) / 1000 - ts;
+}
+
+function buildTimeline(zoneName: string, from: number, to: number): OffsetTimeline {
+  const timeline: OffsetTimeline = { from, to, initial: intlOffsetSeconds(zoneName, from), changes: [], offsets: [] };
+  let prevTs = from;
+  let prevOffset = timeline.initial;
+  for (let ts = from + DAY_SECONDS; prevTs < to; ts += DAY_SECONDS) {
+    const probe = Math.min(ts, to);
+    const offset = intlOffsetSeconds(zoneName, probe);
+    if (offset !== prevOffset) {
+      let lo = prevTs; // offset(lo) === prevOffset
+      let hi = probe;  // offset(hi) !== prevOffset
+      while (hi - lo > 1) {
+        const mid = Math.floor((lo + hi) / 2);
+        if (intlOffsetSeconds(zoneName, mid) === prevOffset) lo = mid;
+        else hi = mid;
+      }
+      timeline.changes.push(hi);
+      timeline.offsets.push(intlOffsetSeconds(zoneName, hi));
+    }
+    prevTs = probe;
+    prevOffset = offset;
+  }
+  return timeline;
+}
+
+/** Offset timeline of a zone covering [from, to], extended on demand */
+function timelineFor(zoneName: string, from: number, to: number): OffsetTimeline {
+  let timeline = timelines.get(zoneName);
+  if (!timeline || from < timeline.from) {
+    timeline = buildTimeline(zoneName, from, Math.max(to, timeline?.to ?? to));
+    timelines.set(zoneName, timeline);
+  } else if (to > timeline.to) {
+    // Later years: scan only the new tail, which starts on the last offset
+    const tail = buildTimeline(zoneName, timeline.to, to);
+    timeline.changes.push(...tail.changes);
+    timeline.offsets.push(...tail.offsets);
+    timeline.to = to;
+  }
+  return timeline;
+}
+
+function timelineOffset(timeline: OffsetTimeline, ts: number): number {
+  let lo = 0;
+  let hi = timeline.changes.length; // first change after ts
+  while (lo < hi) {
+    const mid = (lo + hi) >> 1;
+    if (timeline.changes[mid] <= ts) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo === 0 ? timeline.initial : timeline.offsets[lo - 1];
+}
+
+function changesWithin(timeline: OffsetTimeline, from: number, to: number): boolean {
+  return timeline.changes.some(ts => ts >= from && ts < to);
+}
+
+/** Luxon-equivalent findDstTransitions from the zone's timeline, or null to fall back */
+function fastDstTransitions(zoneName: string, year: number): DstTransitions | null {
+  // Jan 1 and May references of every local year the walk can touch
+  const timeline = timelineFor(zoneName, Date.UTC(year - 1, 0, 1) / 1000 - 2 * DAY_SECONDS,
+                               Date.UTC(year + 2, 0, 1) / 1000 + 2 * DAY_SECONDS);
+  const references = new Map<number, [number, number] | null>();
+  const referenceOffsets = (localYear: number): [number, number] | null => {
+    if (!references.has(localYear)) {
+      const jan1 = Date.UTC(localYear, 0, 1) / 1000;
+      const steady = !changesWithin(timeline, jan1 - DAY_SECONDS, jan1 + DAY_SECONDS) &&
+                     !changesWithin(timeline, Date.UTC(localYear, 3, 29) / 1000, Date.UTC(localYear, 5, 2) / 1000) &&
+                     jan1 - DAY_SECONDS >= timeline.from && Date.UTC(localYear, 5, 2) / 1000 <= timeline.to;
+      references.set(localYear, steady
+        ? [timelineOffset(timeline, jan1), timelineOffset(timeline, Date.UTC(localYear, 4, 15) / 1000)]
+        : null);
+    }
+    return references.get(localYear)!;
+  };
+
+  let unsteady = false;
+  const detailsAt: DetailsAt = (ts) => {
+    const offsetSeconds = timelineOffset(timeline, ts);
+    const refs = referenceOffsets(new Date((ts + offsetSeconds) * 1000).getUTCFullYear());
+    if (!refs) {
+      unsteady = true;
+      return { offsetSeconds, isDST: false };
+    }
+    return { offsetSeconds, isDST: offsetSeconds > refs[0] || offsetSeconds > refs[1] };
+  };
+  const result = walkDstTransitions(year, detailsAt);
+  if (unsteady) return null;
+
+  // One check against Luxon where the answer is decided: the walk's start
+  // and both sides of every transition it reports
+  const startCursor = Date.UTC(year, 0, 1) / 1000 - HOUR_SECONDS;
+  const checks = [startCursor];
+  for (const ts of [result[2], result[3]]) if (ts) checks.push(ts - HOUR_SECONDS, ts);
+  for (const ts of checks) {
+    const luxon = getTzDetails(zoneName, DateTime.fromSeconds(ts, { zone: 'utc' }));
+    const fast = detailsAt(ts);
+    if (!luxon || luxon.offsetSeconds !== fast!.offsetSeconds || luxon.isDST !== fast!.isDST) return null;
+  }
+  return result;
+}
+
+/**
+ * Return [std_offset_sec, dst_offset_sec, dst_start_utc_ts, dst_end_utc_ts].
+ * If the zone does not observe DST, std == dst and transition timestamps are 0.
+ * Caches results per zone/year combination.  Takes the timeline fast path
+ * when it applies, which gives the same tuple as findDstTransitionsByWalk().
+ */
+export function findDstTransitions(zoneName: string, year: number): DstTransitions {
+  const cacheKey = `${zoneName}:${year}`;
+  if (transitionCache.has(cacheKey)) {
+    return transitionCache.get(cacheKey)!;
+  }
+
+  // Validate zone early
+  if (!IANAZone.isValidZone(zoneName)) {
+    return [0, 0, 0, 0];
+  }
+
+  let result = fastDstTransitions(zoneName, year);
+  if (result) {
+    fastPathCount++;
+  } else {
+    walkFallbackCount++;
+    result = findDstTransitionsByWalk(zoneName, year);
+  }
   transitionCache.set(cacheKey, result);
   return result;
-} 
+}
+
+/** The reference path: the same walk, with every probe a Luxon DateTime */
+export function findDstTransitionsByWalk(zoneName: string, year: number): DstTransitions {
+  const cacheKey = `${zoneName}:${year}`;
+  if (walkCache.has(cacheKey)) {
+    return walkCache.get(cacheKey)!;
+  }
+  if (!IANAZone.isValidZone(zoneName)) {
+    return [0, 0, 0, 0];
+  }
+  const startCursor = DateTime.utc(year, 1, 1).minus({ hours: 1 });
+  if (!getTzDetails(zoneName, startCursor)) {
+    // Should never happen for valid zones but keep behaviour consistent.
+    return [0, 0, 0, 0];
+  }
+  const result = walkDstTransitions(year, ts => getTzDetails(zoneName, DateTime.fromSeconds(ts, { zone: 'utc' })));
+  walkCache.set(cacheKey, result);
+  return result;
+}
+
+/** How many zone/years took the fast path and how many fell back to the walk */
+export function dstTransitionStats(): { fast: number; walked: number } {
+  return { fast: fastPathCount, walked: walkFallbackCount };
+}
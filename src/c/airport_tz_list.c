@@ -1,611 +1,744 @@
 // Auto-generated by generateAirportTzList.ts
 // Generated on: 2025-05-05T01:10:00.243Z
-// Year-specific DST data for 2025
+// DST data for 2025-2035
 
 #include <stdint.h>
 
-static const uint16_t airport_code_pool_bits[] = {
-    0x3de6, /* PPG */
-    0x2284, /* IUE */
-    0x1668, /* FTI */
-    0x1dab, /* HNL */
-    0x29c0, /* KOA */
-    0x2d07, /* LIH */
-    0x226e, /* ITO */
-    0x314a, /* MKK */
-    0x24ec, /* JHM */
-    0x2db8, /* LNY */
-    0x6a, /* ADK */
-    0x34f5, /* NHV */
-    0x290, /* AUQ */
-    0x500f, /* UAP */
-    0x5007, /* UAH */
-    0x1991, /* GMR */
-    0x1a2, /* ANC */
-    0x2c17, /* LAX */
-    0x48ae, /* SFO */
-    0x2c12, /* LAS */
-    0x4880, /* SEA */
-    0x62b1, /* YVR */
-    0x480d, /* SAN */
-    0x3c77, /* PDX */
-    0x380a, /* OAK */
-    0x4922, /* SJC */
-    0x4985, /* SMF */
-    0x49a0, /* SNA */
-    0x4d09, /* TIJ */
-    0x39b3, /* ONT */
-    0x2cc1, /* LGB */
-    0x691, /* BUR */
-    0x3e4f, /* PSP */
-    0x6309, /* YYJ */
-    0x6176, /* YLW */
-    0x1413, /* FAT */
-    0x4820, /* SBA */
-    0x3cf7, /* PHX */
-    0xc8d, /* DEN */
-    0x4962, /* SLC */
-    0x6302, /* YYC */
-    0x6086, /* YEG */
-    0x30, /* ABQ */
-    0x116f, /* ELP */
-    0x3097, /* MEX */
-    0x186b, /* GDL */
-    0x3278, /* MTY */
-    0x492e, /* SJO */
-    0x3a23, /* ORD */
-    0xcb6, /* DFW */
-    0x2007, /* IAH */
-    0x324f, /* MSP */
-    0x3076, /* MDW */
-    0xc0b, /* DAL */
-    0x4a6b, /* STL */
-    0x5a0, /* BNA */
-    0x292, /* AUS */
-    0x1dd4, /* HOU */
-    0x3258, /* MSY */
-    0x3048, /* MCI */
-    0x4813, /* SAT */
-    0x3980, /* OMA */
-    0x62c6, /* YWG */
-    0x3144, /* MKE */
-    0x21e2, /* IPC */
-    0x5c6, /* BOG */
-    0xa8d, /* CUN */
-    0x2d0c, /* LIM */
-    0x1c15, /* HAV */
-    0x26b, /* ATL */
-    0x24aa, /* JFK */
-    0x6319, /* YYZ */
-    0x973, /* CLT */
-    0x304e, /* MCO */
-    0x3100, /* MIA */
-    0x12d1, /* EWR */
-    0x5d2, /* BOS */
-    0xe76, /* DTW */
-    0x156b, /* FLL */
-    0x3a2b, /* ORL */
-    0x2cc0, /* LGA */
-    0x3ceb, /* PHL */
-    0x6c8, /* BWI */
-    0xc40, /* DCA */
-    0x2003, /* IAD */
-    0x4de0, /* TPA */
-    0x328d, /* MUN */
-    0x8c1, /* CGB */
-    0x300e, /* MAO */
-    0x4aec, /* SXM */
-    0x8d1, /* CGR */
-    0x3ea7, /* PVH */
-    0x6a1, /* BVB */
-    0x60f9, /* YHZ */
-    0x484b, /* SCL */
-    0x6313, /* YYT */
-    0x6065, /* YDF */
-    0x6018, /* YAY */
-    0x6217, /* YQX */
-    0x62cc, /* YWM */
-    0x60b7, /* YFX */
-    0x60e0, /* YHA */
-    0x1a34, /* GRU */
-    0x8c7, /* CGH */
-    0x641, /* BSB */
-    0x1906, /* GIG */
-    0x8f, /* AEP */
-    0x1324, /* EZE */
-    0x9a5, /* CNF */
-    0x544f, /* VCP */
-    0x4874, /* SDU */
-    0x3dc0, /* POA */
-    0x4482, /* REC */
-    0x4a40, /* SSA */
-    0xac1, /* CWB */
-    0x15d1, /* FOR */
-    0x156d, /* FLN */
-    0x48b, /* BEL */
-    0x1b0d, /* GYN */
-    0x5517, /* VIX */
-    0x9d1, /* COR */
-    0x3413, /* NAT */
-    0x164f, /* FSP */
-    0x148d, /* FEN */
-    0x19c7, /* GOH */
-    0x4903, /* SID */
-    0x3c6b, /* PDL */
-    0x4c91, /* TER */
-    0x2885, /* KEF */
-    0x2cf1, /* LHR */
-    0x2cd6, /* LGW */
-    0xe81, /* DUB */
-    0x300d, /* MAN */
-    0x2d12, /* LIS */
-    0x4a6d, /* STN */
-    0x2e6d, /* LTN */
-    0x1068, /* EDI */
-    0x2de0, /* LPA */
-    0x4f7, /* BHX */
-    0x4cb2, /* TFS */
-    0x39ee, /* OPO */
-    0x1960, /* GLA */
-    0x140e, /* FAO */
-    0x632, /* BRS */
-    0x44, /* ACE */
-    0x1684, /* FUE */
-    0x4b2, /* BFS */
-    0x344b, /* NCL */
-    0x98d, /* CMN */
-    0x866, /* CDG */
-    0x192, /* AMS */
-    0x1620, /* FRA */
-    0x3003, /* MAD */
-    0x44d, /* BCN */
-    0x3282, /* MUC */
-    0x144e, /* FCO */
-    0x6627, /* ZRH */
-    0x9e7, /* CPH */
-    0x3d88, /* PMI */
-    0x3a4b, /* OSL */
-    0x22d, /* ARN */
-    0x634, /* BRU */
-    0xe92, /* DUS */
-    0x5504, /* VIE */
-    0x32ef, /* MXP */
-    0x4eeb, /* TXL */
-    0xcf, /* AGP */
-    0x1c0c, /* HAM */
-    0x1aa0, /* GVA */
-    0x25a1, /* JNB */
-    0x9f3, /* CPT */
-    0xe91, /* DUR */
-    0x2a33, /* KRT */
-    0x28c3, /* KGD */
-    0x4d75, /* TLV */
-    0x498, /* BEY */
-    0x2915, /* KIV */
-    0x267, /* ATH */
-    0x1c8b, /* HEL */
-    0x3a6f, /* OTP */
-    0x282f, /* KBP */
-    0x1c91, /* HER */
-    0x49c5, /* SOF */
-    0x4946, /* SKG */
-    0x4517, /* RIX */
-    0x44ee, /* RHO */
-    0x104d, /* ECN */
-    0x1b20, /* GZA */
-    0x808, /* CAI */
-    0x1e26, /* HRG */
-    0x4a47, /* SSH */
-    0x1c24, /* HBE */
-    0x2253, /* IST */
-    0x4aae, /* SVO */
-    0x2483, /* JED */
-    0x4816, /* SAW */
-    0xd84, /* DME */
-    0x313, /* AYT */
-    0x4687, /* RUH */
-    0x554e, /* VKO */
-    0x2c83, /* LED */
-    0x1241, /* ESB */
-    0x61, /* ADB */
-    0x63, /* ADD */
-    0x342e, /* NBO */
-    0x3083, /* MED */
-    0x91, /* AER */
-    0x60, /* ADA */
-    0x490f, /* SIP */
-    0xd6c, /* DLM */
-    0x3250, /* MSQ */
-    0x535, /* BJV */
-    0x4cf1, /* THR */
-    0x30e3, /* MHD */
-    0x2140, /* IKA */
-    0x4b19, /* SYZ */
-    0x2d9, /* AWZ */
-    0x2907, /* KIH */
-    0x20ad, /* IFN */
-    0x4c39, /* TBZ */
-    0x5a3, /* BND */
-    0x3cd4, /* PGU */
-    0x2891, /* KER */
-    0x323, /* AZD */
-    0x23, /* ABD */
-    0x699, /* BUZ */
-    0x6407, /* ZAH */
-    0x3987, /* OMH */
-    0x4412, /* RAS */
-    0xee1, /* DXB */
-    0x287, /* AUH */
-    0x48e9, /* SHJ */
-    0x3234, /* MRU */
-    0x4c32, /* TBS */
-    0x2a85, /* KUF */
-    0x468d, /* RUN */
-    0xec2, /* DWC */
-    0x245, /* ASF */
-    0x692, /* BUS */
-    0x4553, /* RKT */
-    0x2a93, /* KUT */
-    0x212a, /* IJK */
-    0x5178, /* ULY */
-    0x282b, /* KBL */
-    0x1c80, /* HEA */
-    0x2867, /* KDH */
-    0x3331, /* MZR */
-    0x3199, /* MMZ */
-    0x1423, /* FBD */
-    0x4ab7, /* SVX */
-    0x50a0, /* UFA */
-    0x4d2c, /* TJM */
-    0x48c2, /* SGC */
-    0x88a, /* CEK */
-    0x3c84, /* PEE */
-    0x3697, /* NUX */
-    0x448d, /* REN */
-    0x3522, /* NJC */
-    0x4978, /* SLY */
-    0x1d80, /* HMA */
-    0x35c9, /* NOJ */
-    0x370c, /* NYM */
-    0x3205, /* MQF */
-    0x28cf, /* KGP */
-    0xc8b, /* DEL */
-    0x5cc, /* BOM */
-    0x571, /* BLR */
-    0x854, /* CCU */
-    0x3000, /* MAA */
-    0x9ca, /* COK */
-    0x3db0, /* PNQ */
-    0x183, /* AMD */
-    0x19c8, /* GOI */
-    0x2408, /* JAI */
-    0x2d4e, /* LKO */
-    0x1814, /* GAU */
-    0x4e35, /* TRV */
-    0x428, /* BBI */
-    0x849, /* CCJ */
-    0x3c13, /* PAT */
-    0x2071, /* IDR */
-    0x5679, /* VTZ */
-    0x4af1, /* SXR */
-    0x921, /* CJB */
-    0x2a6c, /* KTM */
-    0x6c0, /* BWA */
-    0x511, /* BIR */
-    0x288f, /* KEP */
-    0x4de9, /* TPJ */
-    0x4d88, /* TMI */
-    0x4f1, /* BHR */
-    0x46f, /* BDP */
-    0x3992, /* OMS */
-    0x44cd, /* RGN */
-    0x306b, /* MDL */
-    0x8ca, /* CGK */
-    0x54a, /* BKK */
-    0xd8a, /* DMK */
-    0x48cd, /* SGN */
-    0x1c0d, /* HAN */
-    0x4a81, /* SUB */
-    0x1d53, /* HKT */
-    0x29ae, /* KNO */
-    0xc03, /* DAD */
-    0x9b7, /* CNX */
-    0x25c6, /* JOG */
-    0x1d6f, /* HLP */
-    0x667, /* BTH */
-    0x3d6c, /* PLM */
-    0x3aa1, /* OVB */
-    0xaf1, /* CXR */
-    0x3d54, /* PKU */
-    0x1c78, /* HDY */
-    0x4a26, /* SRG */
-    0x2835, /* KBV */
-    0x3c8a, /* PEK */
-    0x1d46, /* HKG */
-    0x3ea6, /* PVG */
-    0x80d, /* CAN */
-    0x490d, /* SIN */
-    0x2a8b, /* KUL */
-    0xa74, /* CTU */
-    0x4b37, /* SZX */
-    0x4de4, /* TPE */
-    0x2986, /* KMG */
-    0x31ab, /* MNL */
-    0x48e0, /* SHA */
-    0x5d18, /* XIY */
-    0x946, /* CKG */
-    0x1cc7, /* HGH */
-    0x3546, /* NKG */
-    0x5d8d, /* XMN */
-    0x8ce, /* CGO */
-    0xa57, /* CSX */
-    0x4c0e, /* TAO */
-    0x1da3, /* HND */
-    0x204d, /* ICN */
-    0x3633, /* NRT */
-    0x934, /* CJU */
-    0x2917, /* KIX */
-    0x198f, /* GMP */
-    0x168a, /* FUK */
-    0xa72, /* CTS */
-    0x3940, /* OKA */
-    0x3e92, /* PUS */
-    0x226c, /* ITM */
-    0x34ce, /* NGO */
-    0x29c9, /* KOJ */
-    0x4c04, /* TAE */
-    0x2989, /* KMJ */
-    0x4869, /* SDJ */
-    0x34d2, /* NGS */
-    0x2988, /* KMI */
-    0x3309, /* MYJ */
-    0x929, /* CJJ */
-    0xe36, /* DRW */
-    0x24f, /* ASP */
-    0x310, /* AYQ */
-    0x6b, /* ADL */
-    0x3d6e, /* PLO */
-    0x30c1, /* MGB */
-    0x396f, /* OLP */
-    0x5a4, /* BNE */
-    0x39cb, /* OOL */
-    0x9b2, /* CNS */
-    0x56ae, /* VVO */
-    0x28f5, /* KHV */
-    0x4e55, /* TSV */
-    0x3158, /* MKY */
-    0x3dcc, /* POM */
-    0x3058, /* MCY */
-    0x45ca, /* ROK */
-    0x1e68, /* HTI */
-    0x1973, /* GLT */
-    0x4b03, /* SYD */
-    0x308b, /* MEL */
-    0x831, /* CBR */
-    0x1c20, /* HBA */
-    0x2e53, /* LST */
-    0x366b, /* NTL */
-    0x5aa, /* BNK */
-    0x8b2, /* CFS */
-    0x2c67, /* LDH */
-    0x5292, /* UUS */
-    0x356a, /* NLK */
-    0x340d, /* NAN */
-    0x3d42, /* PKC */
-    0x14b, /* AKL */
-    0x8e2, /* CHC */
-    0x5966, /* WLG */
-    0x660d, /* ZQN */
-    0x364d, /* NSN */
-    0xe83, /* DUD */
-    0x35e4, /* NPE */
-    0x3d91, /* PMR */
-    0x35eb, /* NPL */
-    0x4e26, /* TRG */
-    0x1d79, /* HLZ */
-    0x4e4, /* BHE */
-    0x22a2, /* IVC */
-    0x45d3, /* ROT */
-    0x8f3, /* CHT */
-    0x1f6, /* APW */
-    0x4c34, /* TBU */
-    0x5415, /* VAV */
-    0x1de0, /* HPA */
-    0x1280, /* EUA */
-    0x3673, /* NTT */
-    0xae8, /* CXI */
-};
-
-#define AIRPORT_CODE_POOL_BITS_COUNT 409
+// Total timezone variants: 60
+// Bucket table (loaded from the airport data resource at runtime):
+//   { -44, -44, 0, 3 }, // Pacific/Pago_Pago, Pacific/Midway, Pacific/Niue (-11.00h/-11.00h)
+//   { -40, -40, 3, 7 }, // Pacific/Rarotonga, Pacific/Honolulu, Pacific/Tahiti (-10.00h/-10.00h)
+//   { -40, -36, 10, 1 }, // America/Adak (-10.00h/-9.00h)
+//   { -38, -38, 11, 4 }, // Pacific/Marquesas (-9.50h/-9.50h)
+//   { -36, -36, 15, 1 }, // Pacific/Gambier (-9.00h/-9.00h)
+//   { -36, -32, 16, 1 }, // America/Anchorage (-9.00h/-8.00h)
+//   { -32, -28, 17, 20 }, // America/Vancouver, America/Tijuana, America/Los_Angeles (-8.00h/-7.00h)
+//   { -28, -28, 37, 1 }, // America/Dawson_Creek, America/Mazatlan, America/Hermosillo (-7.00h/-7.00h)
+//   { -28, -24, 38, 6 }, // America/Edmonton, America/Denver, America/Inuvik (-7.00h/-6.00h)
+//   { -24, -24, 44, 4 }, // America/Regina, America/Guatemala, America/Tegucigalpa (-6.00h/-6.00h)
+//   { -24, -20, 48, 16 }, // America/Winnipeg, America/Chicago (-6.00h/-5.00h)
+//   { -24, -20, 64, 1 }, // Pacific/Easter (-6.00h/-5.00h)
+//   { -20, -20, 65, 3 }, // America/Coral_Harbour, America/Jamaica, America/Cancun (-5.00h/-5.00h)
+//   { -20, -16, 68, 1 }, // America/Havana (-5.00h/-4.00h)
+//   { -20, -16, 69, 17 }, // America/Toronto, America/Grand_Turk, America/Port-au-Prince (-5.00h/-4.00h)
+//   { -16, -16, 86, 7 }, // America/Santo_Domingo, America/Campo_Grande, America/Boa_Vista (-4.00h/-4.00h)
+//   { -16, -12, 93, 1 }, // America/Thule, America/Halifax, Atlantic/Bermuda (-4.00h/-3.00h)
+//   { -16, -12, 94, 1 }, // America/Santiago (-4.00h/-3.00h)
+//   { -14, -10, 95, 7 }, // America/St_Johns (-3.50h/-2.50h)
+//   { -12, -12, 102, 20 }, // Atlantic/Stanley, America/Cordoba, America/Buenos_Aires (-3.00h/-3.00h)
+//   { -12, -8, 122, 1 }, // America/Miquelon (-3.00h/-2.00h)
+//   { -8, -8, 123, 1 }, // America/Noronha (-2.00h/-2.00h)
+//   { -8, -4, 124, 1 }, // America/Godthab, America/Scoresbysund (-2.00h/-1.00h)
+//   { -4, -4, 125, 1 }, // Atlantic/Cape_Verde (-1.00h/-1.00h)
+//   { -4, 0, 126, 2 }, // Atlantic/Azores (-1.00h/0.00h)
+//   { 0, 0, 128, 1 }, // Atlantic/Reykjavik, Africa/Ouagadougou, Africa/Accra (0.00h/0.00h)
+//   { 0, 4, 129, 19 }, // Europe/London, Europe/Guernsey, Europe/Jersey (0.00h/1.00h)
+//   { 4, 4, 148, 1 }, // Africa/Algiers, Africa/Porto-Novo, Africa/Lagos (1.00h/1.00h)
+//   { 4, 8, 149, 20 }, // Europe/Brussels, Europe/Berlin, Europe/Amsterdam (1.00h/2.00h)
+//   { 8, 8, 169, 5 }, // Africa/Johannesburg, Africa/Gaborone, Africa/Mbabane (2.00h/2.00h)
+//   { 8, 12, 174, 1 }, // Asia/Jerusalem (2.00h/3.00h)
+//   { 8, 12, 175, 1 }, // Asia/Beirut (2.00h/3.00h)
+//   { 8, 12, 176, 1 }, // Europe/Chisinau (2.00h/3.00h)
+//   { 8, 12, 177, 10 }, // Europe/Tallinn, Europe/Helsinki, Europe/Mariehamn (2.00h/3.00h)
+//   { 8, 12, 187, 1 }, // Asia/Gaza (2.00h/3.00h)
+//   { 8, 12, 188, 4 }, // Africa/Cairo (2.00h/3.00h)
+//   { 12, 12, 192, 20 }, // Indian/Comoro, Indian/Mayotte, Indian/Antananarivo (3.00h/3.00h)
+//   { 14, 14, 212, 17 }, // Asia/Tehran (3.50h/3.50h)
+//   { 16, 16, 229, 14 }, // Indian/Mauritius, Indian/Reunion, Indian/Mahe (4.00h/4.00h)
+//   { 18, 18, 243, 6 }, // Asia/Kabul (4.50h/4.50h)
+//   { 20, 20, 249, 15 }, // Asia/Karachi, Asia/Qyzylorda, Asia/Oral (5.00h/5.00h)
+//   { 22, 22, 264, 20 }, // Asia/Calcutta, Asia/Colombo, Asia/Kolkata (5.50h/5.50h)
+//   { 23, 23, 284, 8 }, // Asia/Katmandu (5.75h/5.75h)
+//   { 24, 24, 292, 1 }, // Asia/Bishkek, Asia/Omsk, Asia/Dhaka (6.00h/6.00h)
+//   { 26, 26, 293, 2 }, // Asia/Rangoon, Indian/Cocos (6.50h/6.50h)
+//   { 28, 28, 295, 20 }, // Asia/Krasnoyarsk, Asia/Phnom_Penh, Asia/Vientiane (7.00h/7.00h)
+//   { 32, 32, 315, 20 }, // Asia/Taipei, Asia/Manila, Asia/Irkutsk (8.00h/8.00h)
+//   { 36, 36, 335, 20 }, // Pacific/Palau, Asia/Tokyo, Asia/Seoul (9.00h/9.00h)
+//   { 38, 38, 355, 3 }, // Australia/Darwin (9.50h/9.50h)
+//   { 38, 42, 358, 4 }, // Australia/Adelaide (9.50h/10.50h)
+//   { 40, 40, 362, 12 }, // Pacific/Port_Moresby, Pacific/Saipan, Pacific/Guam (10.00h/10.00h)
+//   { 40, 44, 374, 8 }, // Australia/Hobart, Australia/Sydney, Australia/Melbourne (10.00h/11.00h)
+//   { 42, 44, 382, 1 }, // Australia/Lord_Howe (10.50h/11.00h)
+//   { 44, 44, 383, 1 }, // Pacific/Efate, Pacific/Noumea, Pacific/Ponape (11.00h/11.00h)
+//   { 44, 48, 384, 1 }, // Pacific/Norfolk (11.00h/12.00h)
+//   { 48, 48, 385, 2 }, // Pacific/Fiji, Pacific/Tarawa, Pacific/Wallis (12.00h/12.00h)
+//   { 48, 52, 387, 14 }, // Pacific/Auckland (12.00h/13.00h)
+//   { 51, 55, 401, 1 }, // Pacific/Chatham (12.75h/13.75h)
+//   { 52, 52, 402, 6 }, // Pacific/Tongatapu, Pacific/Apia, Pacific/Enderbury (13.00h/13.00h)
+//   { 56, 56, 408, 1 }, // Pacific/Kiritimati (14.00h/14.00h)
 
-// Total airport names: 409
-static const char airport_name_pool[] =
-    "Pago Pago\0" "Niue\0" "Fitiuta\0" "Honolulu\0" 
-    "Kona International At Keahole\0" "Lihue\0" "Hilo\0" "Molokai\0" 
-    "Kapalua\0" "Lanai\0" "Adak\0" "Nuku Hiva\0" "Hiva Oa-Atuona\0" "Ua Pou\0" 
-    "Ua Huka\0" "Totegegie\0" "Ted Stevens Anchorage\0" "Los Angeles\0" 
-    "San Francisco\0" "McCarran\0" "Seattle Tacoma\0" "Vancouver\0" 
-    "San Diego\0" "Portland\0" "Metropolitan Oakland\0" 
-    "Norman Y. Mineta San Jose\0" "Sacramento\0" 
-    "John Wayne Airport-Orange County\0" "General Abelardo L. Rodríguez\0" 
-    "Ontario\0" "Long Beach /Daugherty Field/\0" "Bob Hope\0" "Palm Springs\0" 
-    "Victoria\0" "Kelowna\0" "Fresno Yosemite\0" "Santa Barbara Municipal\0" 
-    "Phoenix Sky Harbor\0" "Denver\0" "Salt Lake City\0" "Calgary\0" 
-    "Edmonton\0" "Albuquerque International Sunport\0" "El Paso\0" 
-    "Licenciado Benito Juarez\0" "Don Miguel Hidalgo Y Costilla\0" 
-    "General Mariano Escobedo\0" "Juan Santamaria\0" "Chicago O'Hare\0" 
-    "Dallas Fort Worth\0" "George Bush Intercontinental Houston\0" 
-    "Minneapolis-St Paul International/Wold-Chamberlain\0" "Chicago Midway\0" 
-    "Dallas Love Field\0" "Lambert St Louis\0" "Nashville\0" 
-    "Austin Bergstrom\0" "William P Hobby\0" "Louis Armstrong New Orleans\0" 
-    "Kansas City\0" "San Antonio\0" "Eppley Airfield\0" 
-    "Winnipeg / James Armstrong Richardson\0" "General Mitchell\0" "Mataveri\0" 
-    "El Dorado\0" "Cancún\0" "Jorge Chávez\0" "José Martí\0" 
-    "Hartsfield Jackson Atlanta\0" "John F Kennedy\0" "Lester B. Pearson\0" 
-    "Charlotte Douglas\0" "Orlando\0" "Miami\0" "Newark Liberty\0" 
-    "General Edward Lawrence Logan\0" "Detroit Metropolitan Wayne County\0" 
-    "Fort Lauderdale Hollywood\0" "Orlando Executive\0" "La Guardia\0" 
-    "Philadelphia\0" "Baltimore/Washington International Thurgood Marshall\0" 
-    "Ronald Reagan Washington National\0" "Washington Dulles\0" "Tampa\0" 
-    "Maturín\0" "Marechal Rondon\0" "Eduardo Gomes\0" "Princess Juliana\0" 
-    "Campo Grande\0" "Governador Jorge Teixeira de Oliveira\0" 
-    "Atlas Brasil Cantanhede\0" "Halifax / Stanfield\0" 
-    "Comodoro Arturo Merino Benítez\0" "St. John's\0" "Deer Lake\0" 
-    "St. Anthony\0" "Gander\0" "Williams Harbour\0" "St. Lewis (Fox Harbour)\0" 
-    "Port Hope Simpson\0" "Guarulhos - Governador André Franco Montoro\0" 
-    "Congonhas\0" "Presidente Juscelino Kubistschek\0" 
-    "Rio Galeão – Tom Jobim\0" "Jorge Newbery Airpark\0" "Ministro Pistarini\0" 
-    "Tancredo Neves\0" "Viracopos\0" "Santos Dumont\0" "Salgado Filho\0" 
-    "Guararapes - Gilberto Freyre\0" "Deputado Luiz Eduardo Magalhães\0" 
-    "Afonso Pena\0" "Pinto Martins\0" "Hercílio Luz\0" 
-    "Val de Cans/Júlio Cezar Ribeiro\0" "Santa Genoveva\0" 
-    "Eurico de Aguiar Salles\0" "Ingeniero Ambrosio Taravella\0" 
-    "Governador Aluízio Alves\0" "St Pierre\0" "Fernando de Noronha\0" 
-    "Godthaab / Nuuk\0" "Amílcar Cabral\0" "João Paulo II\0" "Lajes Field\0" 
-    "Keflavik\0" "London Heathrow\0" "London Gatwick\0" "Dublin\0" 
-    "Manchester\0" "Lisbon Portela\0" "London Stansted\0" "London Luton\0" 
-    "Edinburgh\0" "Gran Canaria\0" "Birmingham\0" "Tenerife South\0" 
-    "Francisco de Sá Carneiro\0" "Glasgow\0" "Faro\0" "Bristol\0" "Lanzarote\0" 
-    "Fuerteventura\0" "Belfast\0" "Newcastle\0" "Mohammed V\0" 
-    "Charles de Gaulle\0" "Amsterdam Airport Schiphol\0" "Frankfurt am Main\0" 
-    "Adolfo Suárez Madrid–Barajas\0" "Barcelona\0" "Munich\0" 
-    "Leonardo da Vinci–Fiumicino\0" "Zürich\0" "Copenhagen Kastrup\0" 
-    "Palma De Mallorca\0" "Oslo Gardermoen\0" "Stockholm-Arlanda\0" 
-    "Brussels\0" "Düsseldorf\0" "Vienna\0" "Malpensa\0" "Berlin-Tegel\0" 
-    "Málaga\0" "Hamburg\0" "Geneva Cointrin\0" "OR Tambo\0" "Cape Town\0" 
-    "King Shaka\0" "Khartoum\0" "Khrabrovo\0" "Ben Gurion\0" 
-    "Beirut Rafic Hariri\0" "Chişinău\0" "Eleftherios Venizelos\0" 
-    "Helsinki Vantaa\0" "Henri Coandă\0" "Boryspil\0" 
-    "Heraklion International Nikos Kazantzakis\0" "Sofia\0" 
-    "Thessaloniki Macedonia\0" "Riga\0" "Diagoras\0" "Ercan\0" 
-    "Yasser Arafat\0" "Cairo\0" "Hurghada\0" "Sharm El Sheikh\0" 
-    "Borg El Arab\0" "Atatürk\0" "Sheremetyevo\0" "King Abdulaziz\0" 
-    "Sabiha Gökçen\0" "Domodedovo\0" "Antalya\0" "King Khaled\0" "Vnukovo\0" 
-    "Pulkovo\0" "Esenboğa\0" "Adnan Menderes\0" "Addis Ababa Bole\0" 
-    "Jomo Kenyatta\0" "Prince Mohammad Bin Abdulaziz\0" "Sochi\0" "Adana\0" 
-    "Simferopol\0" "Dalaman\0" "Minsk National\0" "Milas Bodrum\0" "Mehrabad\0" 
-    "Mashhad\0" "Imam Khomeini\0" "Shiraz Shahid Dastghaib\0" "Ahwaz\0" 
-    "Kish\0" "Esfahan Shahid Beheshti\0" "Tabriz\0" "Bandar Abbas\0" 
-    "Persian Gulf\0" "Kerman\0" "Shahid Sadooghi\0" "Abadan\0" "Bushehr\0" 
-    "Zahedan\0" "Urmia\0" "Sardar-e-Jangal\0" "Dubai\0" "Abu Dhabi\0" 
-    "Sharjah\0" "Sir Seewoosagur Ramgoolam\0" "Tbilisi\0" "Kurumoch\0" 
-    "Roland Garros\0" "Al Maktoum\0" "Astrakhan\0" "Batumi\0" 
-    "Ras Al Khaimah\0" "Kopitnari\0" "Izhevsk\0" "Ulyanovsk East\0" "Kabul\0" 
-    "Herat\0" "Kandahar\0" "Mazar I Sharif\0" "Maimana\0" "Fayzabad\0" 
-    "Koltsovo\0" "Ufa\0" "Roshchino\0" "Surgut\0" "Chelyabinsk Balandino\0" 
-    "Bolshoye Savino\0" "Novy Urengoy\0" "Orenburg Central\0" 
-    "Nizhnevartovsk\0" "Salekhard\0" "Khanty Mansiysk\0" "Noyabrsk\0" "Nadym\0" 
-    "Magnitogorsk\0" "Kogalym\0" "Indira Gandhi\0" "Chhatrapati Shivaji\0" 
-    "Kempegowda\0" "Netaji Subhash Chandra Bordoloi\0" "Chennai\0" "Cochin\0" 
-    "Pune\0" "Sardar Vallabhbhai Patel\0" "Dabolim\0" "Jaipur\0" 
-    "Chaudhary Charan Singh\0" "Lokpriya Gopinath Bordoloi\0" "Trivandrum\0" 
-    "Biju Patnaik\0" "Calicut\0" "Lok Nayak Jayaprakash\0" 
-    "Devi Ahilyabai Holkar\0" "Vishakhapatnam\0" "Sheikh ul Alam\0" 
-    "Coimbatore\0" "Tribhuvan\0" "Gautam Buddha\0" "Biratnagar\0" "Nepalgunj\0" 
-    "Taplejung\0" "Tumling Tar\0" "Bharatpur\0" "Bhadrapur\0" "Omsk Central\0" 
-    "Yangon\0" "Mandalay\0" "Soekarno-Hatta\0" "Suvarnabhumi\0" "Don Mueang\0" 
-    "Tan Son Nhat\0" "Noi Bai\0" "Juanda\0" "Phuket\0" "Kualanamu\0" 
-    "Da Nang\0" "Chiang Mai\0" "Adi Sutjipto\0" "Halim Perdanakusuma\0" 
-    "Hang Nadim\0" "Sultan Mahmud Badaruddin II\0" "Tolmachevo\0" "Cam Ranh\0" 
-    "Sultan Syarif Kasim Ii (Simpang Tiga)\0" "Hat Yai\0" "Achmad Yani\0" 
-    "Krabi\0" "Beijing Capital\0" "Chek Lap Kok\0" "Shanghai Pudong\0" 
-    "Guangzhou Baiyun\0" "Singapore Changi\0" "Kuala Lumpur\0" 
-    "Chengdu Shuangliu\0" "Shenzhen Bao'an\0" "Taiwan Taoyuan\0" 
-    "Kunming Changshui\0" "Ninoy Aquino\0" "Shanghai Hongqiao\0" 
-    "Xi'an Xianyang\0" "Chongqing Jiangbei\0" "Hangzhou Xiaoshan\0" 
-    "Nanjing Lukou\0" "Xiamen Gaoqi\0" "Zhengzhou Xinzheng\0" 
-    "Changsha Huanghua\0" "Liuting\0" "Tokyo Haneda\0" "Incheon\0" "Narita\0" 
-    "Jeju\0" "Kansai\0" "Gimpo\0" "Fukuoka\0" "New Chitose\0" "Naha\0" 
-    "Gimhae\0" "Osaka\0" "Chubu Centrair\0" "Kagoshima\0" "Daegu\0" 
-    "Kumamoto\0" "Sendai\0" "Nagasaki\0" "Miyazaki\0" "Matsuyama\0" 
-    "Cheongju\0" "Darwin\0" "Alice Springs\0" "Ayers Rock Connellan\0" 
-    "Adelaide\0" "Port Lincoln\0" "Mount Gambier\0" "Olympic Dam\0" 
-    "Brisbane\0" "Gold Coast\0" "Cairns\0" "Vladivostok\0" "Khabarovsk-Novy\0" 
-    "Townsville\0" "Mackay\0" "Port Moresby Jacksons\0" "Sunshine Coast\0" 
-    "Rockhampton\0" "Hamilton Island\0" "Gladstone\0" 
-    "Sydney Kingsford Smith\0" "Melbourne\0" "Canberra\0" "Hobart\0" 
-    "Launceston\0" "Newcastle\0" "Ballina Byron Gateway\0" "Coffs Harbour\0" 
-    "Lord Howe Island\0" "Yuzhno-Sakhalinsk\0" "Norfolk Island\0" "Nadi\0" 
-    "Yelizovo\0" "Auckland\0" "Christchurch\0" "Wellington\0" "Queenstown\0" 
-    "Nelson\0" "Dunedin\0" "Hawke's Bay\0" "Palmerston North\0" 
-    "New Plymouth\0" "Tauranga\0" "Hamilton\0" "Woodbourne\0" "Invercargill\0" 
-    "Rotorua Regional\0" "Chatham Islands-Tuuta\0" "Faleolo\0" "Fua'amotu\0" 
-    "Vava'u\0" "Lifuka Island\0" "Kaufana\0" "Kuini Lavenia\0" "Cassidy\0"
-;
+typedef struct {
+    uint16_t hour;           // hours since the start of its table year (UTC)
+    uint8_t  bucket;         // index into the bucket table
+    int8_t   quarters;       // offset in effect from then on, 0.25h units
+} TzEvent;
 
 typedef struct {
-    int8_t  std_quarters;    // std offset in 0.25h units
-    int8_t  dst_quarters;    // dst offset in 0.25h units
-    int32_t dst_start_utc;   // DST start (seconds since epoch)
-    int32_t dst_end_utc;     // DST end (seconds since epoch)
-    uint16_t name_offset;    // Index into airport_name_pool
-    uint8_t  name_count;     // Number of codes in this bucket
-} TzInfo;
+    int32_t  start_utc;      // Jan 1 00:00 UTC of the year
+    uint16_t first_event;    // index of its first event in airport_tz_events
+} TzYear;
 
-// Total timezone variants: 60
-static const TzInfo airport_tz_list[] = {
-    { -44, -44, 0, 0, 0, 3 }, // Pacific/Pago_Pago, Pacific/Midway, Pacific/Niue (-11.00h/-11.00h)
-    { -40, -40, 0, 0, 3, 7 }, // Pacific/Rarotonga, Pacific/Honolulu, Pacific/Tahiti (-10.00h/-10.00h)
-    { -40, -36, 1741521600, 1762081200, 10, 1 }, // America/Adak (-10.00h/-9.00h)
-    { -38, -38, 0, 0, 11, 4 }, // Pacific/Marquesas (-9.50h/-9.50h)
-    { -36, -36, 0, 0, 15, 1 }, // Pacific/Gambier (-9.00h/-9.00h)
-    { -36, -32, 1741518000, 1762077600, 16, 1 }, // America/Anchorage (-9.00h/-8.00h)
-    { -32, -28, 1741514400, 1762074000, 17, 20 }, // America/Vancouver, America/Tijuana, America/Los_Angeles (-8.00h/-7.00h)
-    { -28, -28, 0, 0, 37, 1 }, // America/Dawson_Creek, America/Mazatlan, America/Hermosillo (-7.00h/-7.00h)
-    { -28, -24, 1741510800, 1762070400, 38, 6 }, // America/Edmonton, America/Denver, America/Inuvik (-7.00h/-6.00h)
-    { -24, -24, 0, 0, 44, 4 }, // America/Regina, America/Guatemala, America/Tegucigalpa (-6.00h/-6.00h)
-    { -24, -20, 1741507200, 1762066800, 48, 16 }, // America/Winnipeg, America/Chicago (-6.00h/-5.00h)
-    { -24, -20, 1757217600, 1743908400, 64, 1 }, // Pacific/Easter (-6.00h/-5.00h)
-    { -20, -20, 0, 0, 65, 3 }, // America/Coral_Harbour, America/Jamaica, America/Cancun (-5.00h/-5.00h)
-    { -20, -16, 1741496400, 1762059600, 68, 1 }, // America/Havana (-5.00h/-4.00h)
-    { -20, -16, 1741503600, 1762063200, 69, 17 }, // America/Toronto, America/Grand_Turk, America/Port-au-Prince (-5.00h/-4.00h)
-    { -16, -16, 0, 0, 86, 7 }, // America/Santo_Domingo, America/Campo_Grande, America/Boa_Vista (-4.00h/-4.00h)
-    { -16, -12, 1741500000, 1762059600, 93, 1 }, // America/Thule, America/Halifax, Atlantic/Bermuda (-4.00h/-3.00h)
-    { -16, -12, 1757217600, 1743908400, 94, 1 }, // America/Santiago (-4.00h/-3.00h)
-    { -14, -10, 1741496400, 1762056000, 95, 7 }, // America/St_Johns (-3.50h/-2.50h)
-    { -12, -12, 0, 0, 102, 20 }, // Atlantic/Stanley, America/Cordoba, America/Buenos_Aires (-3.00h/-3.00h)
-    { -12, -8, 1741496400, 1762056000, 122, 1 }, // America/Miquelon (-3.00h/-2.00h)
-    { -8, -8, 0, 0, 123, 1 }, // America/Noronha (-2.00h/-2.00h)
-    { -8, -4, 1743296400, 1761440400, 124, 1 }, // America/Godthab, America/Scoresbysund (-2.00h/-1.00h)
-    { -4, -4, 0, 0, 125, 1 }, // Atlantic/Cape_Verde (-1.00h/-1.00h)
-    { -4, 0, 1743296400, 1761440400, 126, 2 }, // Atlantic/Azores (-1.00h/0.00h)
-    { 0, 0, 0, 0, 128, 1 }, // Atlantic/Reykjavik, Africa/Ouagadougou, Africa/Accra (0.00h/0.00h)
-    { 0, 4, 1743296400, 1761440400, 129, 19 }, // Europe/London, Europe/Guernsey, Europe/Jersey (0.00h/1.00h)
-    { 4, 4, 0, 0, 148, 1 }, // Africa/Algiers, Africa/Porto-Novo, Africa/Lagos (1.00h/1.00h)
-    { 4, 8, 1743296400, 1761440400, 149, 20 }, // Europe/Brussels, Europe/Berlin, Europe/Amsterdam (1.00h/2.00h)
-    { 8, 8, 0, 0, 169, 5 }, // Africa/Johannesburg, Africa/Gaborone, Africa/Mbabane (2.00h/2.00h)
-    { 8, 12, 1743120000, 1761433200, 174, 1 }, // Asia/Jerusalem (2.00h/3.00h)
-    { 8, 12, 1743285600, 1761426000, 175, 1 }, // Asia/Beirut (2.00h/3.00h)
-    { 8, 12, 1743292800, 1761436800, 176, 1 }, // Europe/Chisinau (2.00h/3.00h)
-    { 8, 12, 1743296400, 1761440400, 177, 10 }, // Europe/Tallinn, Europe/Helsinki, Europe/Mariehamn (2.00h/3.00h)
-    { 8, 12, 1744416000, 1761346800, 187, 1 }, // Asia/Gaza (2.00h/3.00h)
-    { 8, 12, 1745532000, 1761858000, 188, 4 }, // Africa/Cairo (2.00h/3.00h)
-    { 12, 12, 0, 0, 192, 20 }, // Indian/Comoro, Indian/Mayotte, Indian/Antananarivo (3.00h/3.00h)
-    { 14, 14, 0, 0, 212, 17 }, // Asia/Tehran (3.50h/3.50h)
-    { 16, 16, 0, 0, 229, 14 }, // Indian/Mauritius, Indian/Reunion, Indian/Mahe (4.00h/4.00h)
-    { 18, 18, 0, 0, 243, 6 }, // Asia/Kabul (4.50h/4.50h)
-    { 20, 20, 0, 0, 249, 15 }, // Asia/Karachi, Asia/Qyzylorda, Asia/Oral (5.00h/5.00h)
-    { 22, 22, 0, 0, 264, 20 }, // Asia/Calcutta, Asia/Colombo, Asia/Kolkata (5.50h/5.50h)
-    { 23, 23, 0, 0, 284, 8 }, // Asia/Katmandu (5.75h/5.75h)
-    { 24, 24, 0, 0, 292, 1 }, // Asia/Bishkek, Asia/Omsk, Asia/Dhaka (6.00h/6.00h)
-    { 26, 26, 0, 0, 293, 2 }, // Asia/Rangoon, Indian/Cocos (6.50h/6.50h)
-    { 28, 28, 0, 0, 295, 20 }, // Asia/Krasnoyarsk, Asia/Phnom_Penh, Asia/Vientiane (7.00h/7.00h)
-    { 32, 32, 0, 0, 315, 20 }, // Asia/Taipei, Asia/Manila, Asia/Irkutsk (8.00h/8.00h)
-    { 36, 36, 0, 0, 335, 20 }, // Pacific/Palau, Asia/Tokyo, Asia/Seoul (9.00h/9.00h)
-    { 38, 38, 0, 0, 355, 3 }, // Australia/Darwin (9.50h/9.50h)
-    { 38, 42, 1759593600, 1743872400, 358, 4 }, // Australia/Adelaide (9.50h/10.50h)
-    { 40, 40, 0, 0, 362, 12 }, // Pacific/Port_Moresby, Pacific/Saipan, Pacific/Guam (10.00h/10.00h)
-    { 40, 44, 1759593600, 1743868800, 374, 8 }, // Australia/Hobart, Australia/Sydney, Australia/Melbourne (10.00h/11.00h)
-    { 42, 44, 1759593600, 1743865200, 382, 1 }, // Australia/Lord_Howe (10.50h/11.00h)
-    { 44, 44, 0, 0, 383, 1 }, // Pacific/Efate, Pacific/Noumea, Pacific/Ponape (11.00h/11.00h)
-    { 44, 48, 1759590000, 1743865200, 384, 1 }, // Pacific/Norfolk (11.00h/12.00h)
-    { 48, 48, 0, 0, 385, 2 }, // Pacific/Fiji, Pacific/Tarawa, Pacific/Wallis (12.00h/12.00h)
-    { 48, 52, 1758981600, 1743861600, 387, 14 }, // Pacific/Auckland (12.00h/13.00h)
-    { 51, 55, 1758981600, 1743861600, 401, 1 }, // Pacific/Chatham (12.75h/13.75h)
-    { 52, 52, 0, 0, 402, 6 }, // Pacific/Tongatapu, Pacific/Apia, Pacific/Enderbury (13.00h/13.00h)
-    { 56, 56, 0, 0, 408, 1 }, // Pacific/Kiritimati (14.00h/14.00h)
+// Total DST transition events: 624
+static const TzEvent airport_tz_events[] = {
+    { 0, 11, -20 }, // 2025 Pacific/Easter -> -5.00h
+    { 0, 17, -12 }, // 2025 America/Santiago -> -3.00h
+    { 0, 49, 42 }, // 2025 Australia/Adelaide -> 10.50h
+    { 0, 51, 44 }, // 2025 Australia/Hobart -> 11.00h
+    { 0, 52, 44 }, // 2025 Australia/Lord_Howe -> 11.00h
+    { 0, 54, 48 }, // 2025 Pacific/Norfolk -> 12.00h
+    { 0, 56, 52 }, // 2025 Pacific/Auckland -> 13.00h
+    { 0, 57, 55 }, // 2025 Pacific/Chatham -> 13.75h
+    { 1613, 13, -16 }, // 2025 America/Havana -> -4.00h
+    { 1613, 18, -10 }, // 2025 America/St_Johns -> -2.50h
+    { 1613, 20, -8 }, // 2025 America/Miquelon -> -2.00h
+    { 1614, 16, -12 }, // 2025 America/Thule -> -3.00h
+    { 1615, 14, -16 }, // 2025 America/Toronto -> -4.00h
+    { 1616, 10, -20 }, // 2025 America/Winnipeg -> -5.00h
+    { 1617, 8, -24 }, // 2025 America/Edmonton -> -6.00h
+    { 1618, 6, -28 }, // 2025 America/Vancouver -> -7.00h
+    { 1619, 5, -32 }, // 2025 America/Anchorage -> -8.00h
+    { 1620, 2, -36 }, // 2025 America/Adak -> -9.00h
+    { 2064, 30, 12 }, // 2025 Asia/Jerusalem -> 3.00h
+    { 2110, 31, 12 }, // 2025 Asia/Beirut -> 3.00h
+    { 2112, 32, 12 }, // 2025 Europe/Chisinau -> 3.00h
+    { 2113, 22, -4 }, // 2025 America/Godthab -> -1.00h
+    { 2113, 24, 0 }, // 2025 Atlantic/Azores -> 0.00h
+    { 2113, 26, 4 }, // 2025 Europe/London -> 1.00h
+    { 2113, 28, 8 }, // 2025 Europe/Brussels -> 2.00h
+    { 2113, 33, 12 }, // 2025 Europe/Tallinn -> 3.00h
+    { 2270, 56, 48 }, // 2025 Pacific/Auckland -> 12.00h
+    { 2270, 57, 51 }, // 2025 Pacific/Chatham -> 12.75h
+    { 2271, 52, 42 }, // 2025 Australia/Lord_Howe -> 10.50h
+    { 2271, 54, 44 }, // 2025 Pacific/Norfolk -> 11.00h
+    { 2272, 51, 40 }, // 2025 Australia/Hobart -> 10.00h
+    { 2273, 49, 38 }, // 2025 Australia/Adelaide -> 9.50h
+    { 2283, 11, -24 }, // 2025 Pacific/Easter -> -6.00h
+    { 2283, 17, -16 }, // 2025 America/Santiago -> -4.00h
+    { 2424, 34, 12 }, // 2025 Asia/Gaza -> 3.00h
+    { 2734, 35, 12 }, // 2025 Africa/Cairo -> 3.00h
+    { 5980, 11, -20 }, // 2025 Pacific/Easter -> -5.00h
+    { 5980, 17, -12 }, // 2025 America/Santiago -> -3.00h
+    { 6470, 56, 52 }, // 2025 Pacific/Auckland -> 13.00h
+    { 6470, 57, 55 }, // 2025 Pacific/Chatham -> 13.75h
+    { 6639, 54, 48 }, // 2025 Pacific/Norfolk -> 12.00h
+    { 6640, 49, 42 }, // 2025 Australia/Adelaide -> 10.50h
+    { 6640, 51, 44 }, // 2025 Australia/Hobart -> 11.00h
+    { 6640, 52, 44 }, // 2025 Australia/Lord_Howe -> 11.00h
+    { 7127, 34, 8 }, // 2025 Asia/Gaza -> 2.00h
+    { 7149, 31, 8 }, // 2025 Asia/Beirut -> 2.00h
+    { 7151, 30, 8 }, // 2025 Asia/Jerusalem -> 2.00h
+    { 7152, 32, 8 }, // 2025 Europe/Chisinau -> 2.00h
+    { 7153, 22, -8 }, // 2025 America/Godthab -> -2.00h
+    { 7153, 24, -4 }, // 2025 Atlantic/Azores -> -1.00h
+    { 7153, 26, 0 }, // 2025 Europe/London -> 0.00h
+    { 7153, 28, 4 }, // 2025 Europe/Brussels -> 1.00h
+    { 7153, 33, 8 }, // 2025 Europe/Tallinn -> 2.00h
+    { 7269, 35, 8 }, // 2025 Africa/Cairo -> 2.00h
+    { 7324, 18, -14 }, // 2025 America/St_Johns -> -3.50h
+    { 7324, 20, -12 }, // 2025 America/Miquelon -> -3.00h
+    { 7325, 13, -20 }, // 2025 America/Havana -> -5.00h
+    { 7325, 16, -16 }, // 2025 America/Thule -> -4.00h
+    { 7326, 14, -20 }, // 2025 America/Toronto -> -5.00h
+    { 7327, 10, -24 }, // 2025 America/Winnipeg -> -6.00h
+    { 7328, 8, -28 }, // 2025 America/Edmonton -> -7.00h
+    { 7329, 6, -32 }, // 2025 America/Vancouver -> -8.00h
+    { 7330, 5, -36 }, // 2025 America/Anchorage -> -9.00h
+    { 7331, 2, -40 }, // 2025 America/Adak -> -10.00h
+    { 1589, 13, -16 }, // 2026 America/Havana -> -4.00h
+    { 1589, 18, -10 }, // 2026 America/St_Johns -> -2.50h
+    { 1589, 20, -8 }, // 2026 America/Miquelon -> -2.00h
+    { 1590, 16, -12 }, // 2026 America/Thule -> -3.00h
+    { 1591, 14, -16 }, // 2026 America/Toronto -> -4.00h
+    { 1592, 10, -20 }, // 2026 America/Winnipeg -> -5.00h
+    { 1593, 8, -24 }, // 2026 America/Edmonton -> -6.00h
+    { 1594, 6, -28 }, // 2026 America/Vancouver -> -7.00h
+    { 1595, 5, -32 }, // 2026 America/Anchorage -> -8.00h
+    { 1596, 2, -36 }, // 2026 America/Adak -> -9.00h
+    { 2040, 30, 12 }, // 2026 Asia/Jerusalem -> 3.00h
+    { 2064, 34, 12 }, // 2026 Asia/Gaza -> 3.00h
+    { 2086, 31, 12 }, // 2026 Asia/Beirut -> 3.00h
+    { 2088, 32, 12 }, // 2026 Europe/Chisinau -> 3.00h
+    { 2089, 22, -4 }, // 2026 America/Godthab -> -1.00h
+    { 2089, 24, 0 }, // 2026 Atlantic/Azores -> 0.00h
+    { 2089, 26, 4 }, // 2026 Europe/London -> 1.00h
+    { 2089, 28, 8 }, // 2026 Europe/Brussels -> 2.00h
+    { 2089, 33, 12 }, // 2026 Europe/Tallinn -> 3.00h
+    { 2246, 56, 48 }, // 2026 Pacific/Auckland -> 12.00h
+    { 2246, 57, 51 }, // 2026 Pacific/Chatham -> 12.75h
+    { 2247, 52, 42 }, // 2026 Australia/Lord_Howe -> 10.50h
+    { 2247, 54, 44 }, // 2026 Pacific/Norfolk -> 11.00h
+    { 2248, 51, 40 }, // 2026 Australia/Hobart -> 10.00h
+    { 2249, 49, 38 }, // 2026 Australia/Adelaide -> 9.50h
+    { 2259, 11, -24 }, // 2026 Pacific/Easter -> -6.00h
+    { 2259, 17, -16 }, // 2026 America/Santiago -> -4.00h
+    { 2710, 35, 12 }, // 2026 Africa/Cairo -> 3.00h
+    { 5956, 11, -20 }, // 2026 Pacific/Easter -> -5.00h
+    { 5956, 17, -12 }, // 2026 America/Santiago -> -3.00h
+    { 6446, 56, 52 }, // 2026 Pacific/Auckland -> 13.00h
+    { 6446, 57, 55 }, // 2026 Pacific/Chatham -> 13.75h
+    { 6615, 54, 48 }, // 2026 Pacific/Norfolk -> 12.00h
+    { 6616, 49, 42 }, // 2026 Australia/Adelaide -> 10.50h
+    { 6616, 51, 44 }, // 2026 Australia/Hobart -> 11.00h
+    { 6616, 52, 44 }, // 2026 Australia/Lord_Howe -> 11.00h
+    { 7103, 34, 8 }, // 2026 Asia/Gaza -> 2.00h
+    { 7125, 31, 8 }, // 2026 Asia/Beirut -> 2.00h
+    { 7127, 30, 8 }, // 2026 Asia/Jerusalem -> 2.00h
+    { 7128, 32, 8 }, // 2026 Europe/Chisinau -> 2.00h
+    { 7129, 22, -8 }, // 2026 America/Godthab -> -2.00h
+    { 7129, 24, -4 }, // 2026 Atlantic/Azores -> -1.00h
+    { 7129, 26, 0 }, // 2026 Europe/London -> 0.00h
+    { 7129, 28, 4 }, // 2026 Europe/Brussels -> 1.00h
+    { 7129, 33, 8 }, // 2026 Europe/Tallinn -> 2.00h
+    { 7245, 35, 8 }, // 2026 Africa/Cairo -> 2.00h
+    { 7300, 18, -14 }, // 2026 America/St_Johns -> -3.50h
+    { 7300, 20, -12 }, // 2026 America/Miquelon -> -3.00h
+    { 7301, 13, -20 }, // 2026 America/Havana -> -5.00h
+    { 7301, 16, -16 }, // 2026 America/Thule -> -4.00h
+    { 7302, 14, -20 }, // 2026 America/Toronto -> -5.00h
+    { 7303, 10, -24 }, // 2026 America/Winnipeg -> -6.00h
+    { 7304, 8, -28 }, // 2026 America/Edmonton -> -7.00h
+    { 7305, 6, -32 }, // 2026 America/Vancouver -> -8.00h
+    { 7306, 5, -36 }, // 2026 America/Anchorage -> -9.00h
+    { 7307, 2, -40 }, // 2026 America/Adak -> -10.00h
+    { 1733, 13, -16 }, // 2027 America/Havana -> -4.00h
+    { 1733, 18, -10 }, // 2027 America/St_Johns -> -2.50h
+    { 1733, 20, -8 }, // 2027 America/Miquelon -> -2.00h
+    { 1734, 16, -12 }, // 2027 America/Thule -> -3.00h
+    { 1735, 14, -16 }, // 2027 America/Toronto -> -4.00h
+    { 1736, 10, -20 }, // 2027 America/Winnipeg -> -5.00h
+    { 1737, 8, -24 }, // 2027 America/Edmonton -> -6.00h
+    { 1738, 6, -28 }, // 2027 America/Vancouver -> -7.00h
+    { 1739, 5, -32 }, // 2027 America/Anchorage -> -8.00h
+    { 1740, 2, -36 }, // 2027 America/Adak -> -9.00h
+    { 2016, 30, 12 }, // 2027 Asia/Jerusalem -> 3.00h
+    { 2040, 34, 12 }, // 2027 Asia/Gaza -> 3.00h
+    { 2062, 31, 12 }, // 2027 Asia/Beirut -> 3.00h
+    { 2064, 32, 12 }, // 2027 Europe/Chisinau -> 3.00h
+    { 2065, 22, -4 }, // 2027 America/Godthab -> -1.00h
+    { 2065, 24, 0 }, // 2027 Atlantic/Azores -> 0.00h
+    { 2065, 26, 4 }, // 2027 Europe/London -> 1.00h
+    { 2065, 28, 8 }, // 2027 Europe/Brussels -> 2.00h
+    { 2065, 33, 12 }, // 2027 Europe/Tallinn -> 3.00h
+    { 2222, 56, 48 }, // 2027 Pacific/Auckland -> 12.00h
+    { 2222, 57, 51 }, // 2027 Pacific/Chatham -> 12.75h
+    { 2223, 52, 42 }, // 2027 Australia/Lord_Howe -> 10.50h
+    { 2223, 54, 44 }, // 2027 Pacific/Norfolk -> 11.00h
+    { 2224, 51, 40 }, // 2027 Australia/Hobart -> 10.00h
+    { 2225, 49, 38 }, // 2027 Australia/Adelaide -> 9.50h
+    { 2235, 11, -24 }, // 2027 Pacific/Easter -> -6.00h
+    { 2235, 17, -16 }, // 2027 America/Santiago -> -4.00h
+    { 2854, 35, 12 }, // 2027 Africa/Cairo -> 3.00h
+    { 5932, 11, -20 }, // 2027 Pacific/Easter -> -5.00h
+    { 5932, 17, -12 }, // 2027 America/Santiago -> -3.00h
+    { 6422, 56, 52 }, // 2027 Pacific/Auckland -> 13.00h
+    { 6422, 57, 55 }, // 2027 Pacific/Chatham -> 13.75h
+    { 6591, 54, 48 }, // 2027 Pacific/Norfolk -> 12.00h
+    { 6592, 49, 42 }, // 2027 Australia/Adelaide -> 10.50h
+    { 6592, 51, 44 }, // 2027 Australia/Hobart -> 11.00h
+    { 6592, 52, 44 }, // 2027 Australia/Lord_Howe -> 11.00h
+    { 7221, 35, 8 }, // 2027 Africa/Cairo -> 2.00h
+    { 7247, 34, 8 }, // 2027 Asia/Gaza -> 2.00h
+    { 7269, 31, 8 }, // 2027 Asia/Beirut -> 2.00h
+    { 7271, 30, 8 }, // 2027 Asia/Jerusalem -> 2.00h
+    { 7272, 32, 8 }, // 2027 Europe/Chisinau -> 2.00h
+    { 7273, 22, -8 }, // 2027 America/Godthab -> -2.00h
+    { 7273, 24, -4 }, // 2027 Atlantic/Azores -> -1.00h
+    { 7273, 26, 0 }, // 2027 Europe/London -> 0.00h
+    { 7273, 28, 4 }, // 2027 Europe/Brussels -> 1.00h
+    { 7273, 33, 8 }, // 2027 Europe/Tallinn -> 2.00h
+    { 7444, 18, -14 }, // 2027 America/St_Johns -> -3.50h
+    { 7444, 20, -12 }, // 2027 America/Miquelon -> -3.00h
+    { 7445, 13, -20 }, // 2027 America/Havana -> -5.00h
+    { 7445, 16, -16 }, // 2027 America/Thule -> -4.00h
+    { 7446, 14, -20 }, // 2027 America/Toronto -> -5.00h
+    { 7447, 10, -24 }, // 2027 America/Winnipeg -> -6.00h
+    { 7448, 8, -28 }, // 2027 America/Edmonton -> -7.00h
+    { 7449, 6, -32 }, // 2027 America/Vancouver -> -8.00h
+    { 7450, 5, -36 }, // 2027 America/Anchorage -> -9.00h
+    { 7451, 2, -40 }, // 2027 America/Adak -> -10.00h
+    { 1709, 13, -16 }, // 2028 America/Havana -> -4.00h
+    { 1709, 18, -10 }, // 2028 America/St_Johns -> -2.50h
+    { 1709, 20, -8 }, // 2028 America/Miquelon -> -2.00h
+    { 1710, 16, -12 }, // 2028 America/Thule -> -3.00h
+    { 1711, 14, -16 }, // 2028 America/Toronto -> -4.00h
+    { 1712, 10, -20 }, // 2028 America/Winnipeg -> -5.00h
+    { 1713, 8, -24 }, // 2028 America/Edmonton -> -6.00h
+    { 1714, 6, -28 }, // 2028 America/Vancouver -> -7.00h
+    { 1715, 5, -32 }, // 2028 America/Anchorage -> -8.00h
+    { 1716, 2, -36 }, // 2028 America/Adak -> -9.00h
+    { 1992, 30, 12 }, // 2028 Asia/Jerusalem -> 3.00h
+    { 2016, 34, 12 }, // 2028 Asia/Gaza -> 3.00h
+    { 2038, 31, 12 }, // 2028 Asia/Beirut -> 3.00h
+    { 2040, 32, 12 }, // 2028 Europe/Chisinau -> 3.00h
+    { 2041, 22, -4 }, // 2028 America/Godthab -> -1.00h
+    { 2041, 24, 0 }, // 2028 Atlantic/Azores -> 0.00h
+    { 2041, 26, 4 }, // 2028 Europe/London -> 1.00h
+    { 2041, 28, 8 }, // 2028 Europe/Brussels -> 2.00h
+    { 2041, 33, 12 }, // 2028 Europe/Tallinn -> 3.00h
+    { 2198, 56, 48 }, // 2028 Pacific/Auckland -> 12.00h
+    { 2198, 57, 51 }, // 2028 Pacific/Chatham -> 12.75h
+    { 2199, 52, 42 }, // 2028 Australia/Lord_Howe -> 10.50h
+    { 2199, 54, 44 }, // 2028 Pacific/Norfolk -> 11.00h
+    { 2200, 51, 40 }, // 2028 Australia/Hobart -> 10.00h
+    { 2201, 49, 38 }, // 2028 Australia/Adelaide -> 9.50h
+    { 2211, 11, -24 }, // 2028 Pacific/Easter -> -6.00h
+    { 2211, 17, -16 }, // 2028 America/Santiago -> -4.00h
+    { 2830, 35, 12 }, // 2028 Africa/Cairo -> 3.00h
+    { 5908, 11, -20 }, // 2028 Pacific/Easter -> -5.00h
+    { 5908, 17, -12 }, // 2028 America/Santiago -> -3.00h
+    { 6398, 56, 52 }, // 2028 Pacific/Auckland -> 13.00h
+    { 6398, 57, 55 }, // 2028 Pacific/Chatham -> 13.75h
+    { 6567, 54, 48 }, // 2028 Pacific/Norfolk -> 12.00h
+    { 6568, 49, 42 }, // 2028 Australia/Adelaide -> 10.50h
+    { 6568, 51, 44 }, // 2028 Australia/Hobart -> 11.00h
+    { 6568, 52, 44 }, // 2028 Australia/Lord_Howe -> 11.00h
+    { 7197, 35, 8 }, // 2028 Africa/Cairo -> 2.00h
+    { 7223, 34, 8 }, // 2028 Asia/Gaza -> 2.00h
+    { 7245, 31, 8 }, // 2028 Asia/Beirut -> 2.00h
+    { 7247, 30, 8 }, // 2028 Asia/Jerusalem -> 2.00h
+    { 7248, 32, 8 }, // 2028 Europe/Chisinau -> 2.00h
+    { 7249, 22, -8 }, // 2028 America/Godthab -> -2.00h
+    { 7249, 24, -4 }, // 2028 Atlantic/Azores -> -1.00h
+    { 7249, 26, 0 }, // 2028 Europe/London -> 0.00h
+    { 7249, 28, 4 }, // 2028 Europe/Brussels -> 1.00h
+    { 7249, 33, 8 }, // 2028 Europe/Tallinn -> 2.00h
+    { 7420, 18, -14 }, // 2028 America/St_Johns -> -3.50h
+    { 7420, 20, -12 }, // 2028 America/Miquelon -> -3.00h
+    { 7421, 13, -20 }, // 2028 America/Havana -> -5.00h
+    { 7421, 16, -16 }, // 2028 America/Thule -> -4.00h
+    { 7422, 14, -20 }, // 2028 America/Toronto -> -5.00h
+    { 7423, 10, -24 }, // 2028 America/Winnipeg -> -6.00h
+    { 7424, 8, -28 }, // 2028 America/Edmonton -> -7.00h
+    { 7425, 6, -32 }, // 2028 America/Vancouver -> -8.00h
+    { 7426, 5, -36 }, // 2028 America/Anchorage -> -9.00h
+    { 7427, 2, -40 }, // 2028 America/Adak -> -10.00h
+    { 1661, 13, -16 }, // 2029 America/Havana -> -4.00h
+    { 1661, 18, -10 }, // 2029 America/St_Johns -> -2.50h
+    { 1661, 20, -8 }, // 2029 America/Miquelon -> -2.00h
+    { 1662, 16, -12 }, // 2029 America/Thule -> -3.00h
+    { 1663, 14, -16 }, // 2029 America/Toronto -> -4.00h
+    { 1664, 10, -20 }, // 2029 America/Winnipeg -> -5.00h
+    { 1665, 8, -24 }, // 2029 America/Edmonton -> -6.00h
+    { 1666, 6, -28 }, // 2029 America/Vancouver -> -7.00h
+    { 1667, 5, -32 }, // 2029 America/Anchorage -> -8.00h
+    { 1668, 2, -36 }, // 2029 America/Adak -> -9.00h
+    { 1944, 30, 12 }, // 2029 Asia/Jerusalem -> 3.00h
+    { 1968, 34, 12 }, // 2029 Asia/Gaza -> 3.00h
+    { 1990, 31, 12 }, // 2029 Asia/Beirut -> 3.00h
+    { 1992, 32, 12 }, // 2029 Europe/Chisinau -> 3.00h
+    { 1993, 22, -4 }, // 2029 America/Godthab -> -1.00h
+    { 1993, 24, 0 }, // 2029 Atlantic/Azores -> 0.00h
+    { 1993, 26, 4 }, // 2029 Europe/London -> 1.00h
+    { 1993, 28, 8 }, // 2029 Europe/Brussels -> 2.00h
+    { 1993, 33, 12 }, // 2029 Europe/Tallinn -> 3.00h
+    { 2150, 56, 48 }, // 2029 Pacific/Auckland -> 12.00h
+    { 2150, 57, 51 }, // 2029 Pacific/Chatham -> 12.75h
+    { 2151, 52, 42 }, // 2029 Australia/Lord_Howe -> 10.50h
+    { 2151, 54, 44 }, // 2029 Pacific/Norfolk -> 11.00h
+    { 2152, 51, 40 }, // 2029 Australia/Hobart -> 10.00h
+    { 2153, 49, 38 }, // 2029 Australia/Adelaide -> 9.50h
+    { 2331, 11, -24 }, // 2029 Pacific/Easter -> -6.00h
+    { 2331, 17, -16 }, // 2029 America/Santiago -> -4.00h
+    { 2782, 35, 12 }, // 2029 Africa/Cairo -> 3.00h
+    { 5860, 11, -20 }, // 2029 Pacific/Easter -> -5.00h
+    { 5860, 17, -12 }, // 2029 America/Santiago -> -3.00h
+    { 6518, 56, 52 }, // 2029 Pacific/Auckland -> 13.00h
+    { 6518, 57, 55 }, // 2029 Pacific/Chatham -> 13.75h
+    { 6687, 54, 48 }, // 2029 Pacific/Norfolk -> 12.00h
+    { 6688, 49, 42 }, // 2029 Australia/Adelaide -> 10.50h
+    { 6688, 51, 44 }, // 2029 Australia/Hobart -> 11.00h
+    { 6688, 52, 44 }, // 2029 Australia/Lord_Howe -> 11.00h
+    { 7149, 35, 8 }, // 2029 Africa/Cairo -> 2.00h
+    { 7175, 34, 8 }, // 2029 Asia/Gaza -> 2.00h
+    { 7197, 31, 8 }, // 2029 Asia/Beirut -> 2.00h
+    { 7199, 30, 8 }, // 2029 Asia/Jerusalem -> 2.00h
+    { 7200, 32, 8 }, // 2029 Europe/Chisinau -> 2.00h
+    { 7201, 22, -8 }, // 2029 America/Godthab -> -2.00h
+    { 7201, 24, -4 }, // 2029 Atlantic/Azores -> -1.00h
+    { 7201, 26, 0 }, // 2029 Europe/London -> 0.00h
+    { 7201, 28, 4 }, // 2029 Europe/Brussels -> 1.00h
+    { 7201, 33, 8 }, // 2029 Europe/Tallinn -> 2.00h
+    { 7372, 18, -14 }, // 2029 America/St_Johns -> -3.50h
+    { 7372, 20, -12 }, // 2029 America/Miquelon -> -3.00h
+    { 7373, 13, -20 }, // 2029 America/Havana -> -5.00h
+    { 7373, 16, -16 }, // 2029 America/Thule -> -4.00h
+    { 7374, 14, -20 }, // 2029 America/Toronto -> -5.00h
+    { 7375, 10, -24 }, // 2029 America/Winnipeg -> -6.00h
+    { 7376, 8, -28 }, // 2029 America/Edmonton -> -7.00h
+    { 7377, 6, -32 }, // 2029 America/Vancouver -> -8.00h
+    { 7378, 5, -36 }, // 2029 America/Anchorage -> -9.00h
+    { 7379, 2, -40 }, // 2029 America/Adak -> -10.00h
+    { 1637, 13, -16 }, // 2030 America/Havana -> -4.00h
+    { 1637, 18, -10 }, // 2030 America/St_Johns -> -2.50h
+    { 1637, 20, -8 }, // 2030 America/Miquelon -> -2.00h
+    { 1638, 16, -12 }, // 2030 America/Thule -> -3.00h
+    { 1639, 14, -16 }, // 2030 America/Toronto -> -4.00h
+    { 1640, 10, -20 }, // 2030 America/Winnipeg -> -5.00h
+    { 1641, 8, -24 }, // 2030 America/Edmonton -> -6.00h
+    { 1642, 6, -28 }, // 2030 America/Vancouver -> -7.00h
+    { 1643, 5, -32 }, // 2030 America/Anchorage -> -8.00h
+    { 1644, 2, -36 }, // 2030 America/Adak -> -9.00h
+    { 2088, 30, 12 }, // 2030 Asia/Jerusalem -> 3.00h
+    { 2112, 34, 12 }, // 2030 Asia/Gaza -> 3.00h
+    { 2134, 31, 12 }, // 2030 Asia/Beirut -> 3.00h
+    { 2136, 32, 12 }, // 2030 Europe/Chisinau -> 3.00h
+    { 2137, 22, -4 }, // 2030 America/Godthab -> -1.00h
+    { 2137, 24, 0 }, // 2030 Atlantic/Azores -> 0.00h
+    { 2137, 26, 4 }, // 2030 Europe/London -> 1.00h
+    { 2137, 28, 8 }, // 2030 Europe/Brussels -> 2.00h
+    { 2137, 33, 12 }, // 2030 Europe/Tallinn -> 3.00h
+    { 2294, 56, 48 }, // 2030 Pacific/Auckland -> 12.00h
+    { 2294, 57, 51 }, // 2030 Pacific/Chatham -> 12.75h
+    { 2295, 52, 42 }, // 2030 Australia/Lord_Howe -> 10.50h
+    { 2295, 54, 44 }, // 2030 Pacific/Norfolk -> 11.00h
+    { 2296, 51, 40 }, // 2030 Australia/Hobart -> 10.00h
+    { 2297, 49, 38 }, // 2030 Australia/Adelaide -> 9.50h
+    { 2307, 11, -24 }, // 2030 Pacific/Easter -> -6.00h
+    { 2307, 17, -16 }, // 2030 America/Santiago -> -4.00h
+    { 2758, 35, 12 }, // 2030 Africa/Cairo -> 3.00h
+    { 6004, 11, -20 }, // 2030 Pacific/Easter -> -5.00h
+    { 6004, 17, -12 }, // 2030 America/Santiago -> -3.00h
+    { 6494, 56, 52 }, // 2030 Pacific/Auckland -> 13.00h
+    { 6494, 57, 55 }, // 2030 Pacific/Chatham -> 13.75h
+    { 6663, 54, 48 }, // 2030 Pacific/Norfolk -> 12.00h
+    { 6664, 49, 42 }, // 2030 Australia/Adelaide -> 10.50h
+    { 6664, 51, 44 }, // 2030 Australia/Hobart -> 11.00h
+    { 6664, 52, 44 }, // 2030 Australia/Lord_Howe -> 11.00h
+    { 7151, 34, 8 }, // 2030 Asia/Gaza -> 2.00h
+    { 7173, 31, 8 }, // 2030 Asia/Beirut -> 2.00h
+    { 7175, 30, 8 }, // 2030 Asia/Jerusalem -> 2.00h
+    { 7176, 32, 8 }, // 2030 Europe/Chisinau -> 2.00h
+    { 7177, 22, -8 }, // 2030 America/Godthab -> -2.00h
+    { 7177, 24, -4 }, // 2030 Atlantic/Azores -> -1.00h
+    { 7177, 26, 0 }, // 2030 Europe/London -> 0.00h
+    { 7177, 28, 4 }, // 2030 Europe/Brussels -> 1.00h
+    { 7177, 33, 8 }, // 2030 Europe/Tallinn -> 2.00h
+    { 7293, 35, 8 }, // 2030 Africa/Cairo -> 2.00h
+    { 7348, 18, -14 }, // 2030 America/St_Johns -> -3.50h
+    { 7348, 20, -12 }, // 2030 America/Miquelon -> -3.00h
+    { 7349, 13, -20 }, // 2030 America/Havana -> -5.00h
+    { 7349, 16, -16 }, // 2030 America/Thule -> -4.00h
+    { 7350, 14, -20 }, // 2030 America/Toronto -> -5.00h
+    { 7351, 10, -24 }, // 2030 America/Winnipeg -> -6.00h
+    { 7352, 8, -28 }, // 2030 America/Edmonton -> -7.00h
+    { 7353, 6, -32 }, // 2030 America/Vancouver -> -8.00h
+    { 7354, 5, -36 }, // 2030 America/Anchorage -> -9.00h
+    { 7355, 2, -40 }, // 2030 America/Adak -> -10.00h
+    { 1613, 13, -16 }, // 2031 America/Havana -> -4.00h
+    { 1613, 18, -10 }, // 2031 America/St_Johns -> -2.50h
+    { 1613, 20, -8 }, // 2031 America/Miquelon -> -2.00h
+    { 1614, 16, -12 }, // 2031 America/Thule -> -3.00h
+    { 1615, 14, -16 }, // 2031 America/Toronto -> -4.00h
+    { 1616, 10, -20 }, // 2031 America/Winnipeg -> -5.00h
+    { 1617, 8, -24 }, // 2031 America/Edmonton -> -6.00h
+    { 1618, 6, -28 }, // 2031 America/Vancouver -> -7.00h
+    { 1619, 5, -32 }, // 2031 America/Anchorage -> -8.00h
+    { 1620, 2, -36 }, // 2031 America/Adak -> -9.00h
+    { 2064, 30, 12 }, // 2031 Asia/Jerusalem -> 3.00h
+    { 2088, 34, 12 }, // 2031 Asia/Gaza -> 3.00h
+    { 2110, 31, 12 }, // 2031 Asia/Beirut -> 3.00h
+    { 2112, 32, 12 }, // 2031 Europe/Chisinau -> 3.00h
+    { 2113, 22, -4 }, // 2031 America/Godthab -> -1.00h
+    { 2113, 24, 0 }, // 2031 Atlantic/Azores -> 0.00h
+    { 2113, 26, 4 }, // 2031 Europe/London -> 1.00h
+    { 2113, 28, 8 }, // 2031 Europe/Brussels -> 2.00h
+    { 2113, 33, 12 }, // 2031 Europe/Tallinn -> 3.00h
+    { 2270, 56, 48 }, // 2031 Pacific/Auckland -> 12.00h
+    { 2270, 57, 51 }, // 2031 Pacific/Chatham -> 12.75h
+    { 2271, 52, 42 }, // 2031 Australia/Lord_Howe -> 10.50h
+    { 2271, 54, 44 }, // 2031 Pacific/Norfolk -> 11.00h
+    { 2272, 51, 40 }, // 2031 Australia/Hobart -> 10.00h
+    { 2273, 49, 38 }, // 2031 Australia/Adelaide -> 9.50h
+    { 2283, 11, -24 }, // 2031 Pacific/Easter -> -6.00h
+    { 2283, 17, -16 }, // 2031 America/Santiago -> -4.00h
+    { 2734, 35, 12 }, // 2031 Africa/Cairo -> 3.00h
+    { 5980, 11, -20 }, // 2031 Pacific/Easter -> -5.00h
+    { 5980, 17, -12 }, // 2031 America/Santiago -> -3.00h
+    { 6470, 56, 52 }, // 2031 Pacific/Auckland -> 13.00h
+    { 6470, 57, 55 }, // 2031 Pacific/Chatham -> 13.75h
+    { 6639, 54, 48 }, // 2031 Pacific/Norfolk -> 12.00h
+    { 6640, 49, 42 }, // 2031 Australia/Adelaide -> 10.50h
+    { 6640, 51, 44 }, // 2031 Australia/Hobart -> 11.00h
+    { 6640, 52, 44 }, // 2031 Australia/Lord_Howe -> 11.00h
+    { 7127, 34, 8 }, // 2031 Asia/Gaza -> 2.00h
+    { 7149, 31, 8 }, // 2031 Asia/Beirut -> 2.00h
+    { 7151, 30, 8 }, // 2031 Asia/Jerusalem -> 2.00h
+    { 7152, 32, 8 }, // 2031 Europe/Chisinau -> 2.00h
+    { 7153, 22, -8 }, // 2031 America/Godthab -> -2.00h
+    { 7153, 24, -4 }, // 2031 Atlantic/Azores -> -1.00h
+    { 7153, 26, 0 }, // 2031 Europe/London -> 0.00h
+    { 7153, 28, 4 }, // 2031 Europe/Brussels -> 1.00h
+    { 7153, 33, 8 }, // 2031 Europe/Tallinn -> 2.00h
+    { 7269, 35, 8 }, // 2031 Africa/Cairo -> 2.00h
+    { 7324, 18, -14 }, // 2031 America/St_Johns -> -3.50h
+    { 7324, 20, -12 }, // 2031 America/Miquelon -> -3.00h
+    { 7325, 13, -20 }, // 2031 America/Havana -> -5.00h
+    { 7325, 16, -16 }, // 2031 America/Thule -> -4.00h
+    { 7326, 14, -20 }, // 2031 America/Toronto -> -5.00h
+    { 7327, 10, -24 }, // 2031 America/Winnipeg -> -6.00h
+    { 7328, 8, -28 }, // 2031 America/Edmonton -> -7.00h
+    { 7329, 6, -32 }, // 2031 America/Vancouver -> -8.00h
+    { 7330, 5, -36 }, // 2031 America/Anchorage -> -9.00h
+    { 7331, 2, -40 }, // 2031 America/Adak -> -10.00h
+    { 1757, 13, -16 }, // 2032 America/Havana -> -4.00h
+    { 1757, 18, -10 }, // 2032 America/St_Johns -> -2.50h
+    { 1757, 20, -8 }, // 2032 America/Miquelon -> -2.00h
+    { 1758, 16, -12 }, // 2032 America/Thule -> -3.00h
+    { 1759, 14, -16 }, // 2032 America/Toronto -> -4.00h
+    { 1760, 10, -20 }, // 2032 America/Winnipeg -> -5.00h
+    { 1761, 8, -24 }, // 2032 America/Edmonton -> -6.00h
+    { 1762, 6, -28 }, // 2032 America/Vancouver -> -7.00h
+    { 1763, 5, -32 }, // 2032 America/Anchorage -> -8.00h
+    { 1764, 2, -36 }, // 2032 America/Adak -> -9.00h
+    { 2040, 30, 12 }, // 2032 Asia/Jerusalem -> 3.00h
+    { 2064, 34, 12 }, // 2032 Asia/Gaza -> 3.00h
+    { 2086, 31, 12 }, // 2032 Asia/Beirut -> 3.00h
+    { 2088, 32, 12 }, // 2032 Europe/Chisinau -> 3.00h
+    { 2089, 22, -4 }, // 2032 America/Godthab -> -1.00h
+    { 2089, 24, 0 }, // 2032 Atlantic/Azores -> 0.00h
+    { 2089, 26, 4 }, // 2032 Europe/London -> 1.00h
+    { 2089, 28, 8 }, // 2032 Europe/Brussels -> 2.00h
+    { 2089, 33, 12 }, // 2032 Europe/Tallinn -> 3.00h
+    { 2246, 56, 48 }, // 2032 Pacific/Auckland -> 12.00h
+    { 2246, 57, 51 }, // 2032 Pacific/Chatham -> 12.75h
+    { 2247, 52, 42 }, // 2032 Australia/Lord_Howe -> 10.50h
+    { 2247, 54, 44 }, // 2032 Pacific/Norfolk -> 11.00h
+    { 2248, 51, 40 }, // 2032 Australia/Hobart -> 10.00h
+    { 2249, 49, 38 }, // 2032 Australia/Adelaide -> 9.50h
+    { 2259, 11, -24 }, // 2032 Pacific/Easter -> -6.00h
+    { 2259, 17, -16 }, // 2032 America/Santiago -> -4.00h
+    { 2878, 35, 12 }, // 2032 Africa/Cairo -> 3.00h
+    { 5956, 11, -20 }, // 2032 Pacific/Easter -> -5.00h
+    { 5956, 17, -12 }, // 2032 America/Santiago -> -3.00h
+    { 6446, 56, 52 }, // 2032 Pacific/Auckland -> 13.00h
+    { 6446, 57, 55 }, // 2032 Pacific/Chatham -> 13.75h
+    { 6615, 54, 48 }, // 2032 Pacific/Norfolk -> 12.00h
+    { 6616, 49, 42 }, // 2032 Australia/Adelaide -> 10.50h
+    { 6616, 51, 44 }, // 2032 Australia/Hobart -> 11.00h
+    { 6616, 52, 44 }, // 2032 Australia/Lord_Howe -> 11.00h
+    { 7245, 35, 8 }, // 2032 Africa/Cairo -> 2.00h
+    { 7271, 34, 8 }, // 2032 Asia/Gaza -> 2.00h
+    { 7293, 31, 8 }, // 2032 Asia/Beirut -> 2.00h
+    { 7295, 30, 8 }, // 2032 Asia/Jerusalem -> 2.00h
+    { 7296, 32, 8 }, // 2032 Europe/Chisinau -> 2.00h
+    { 7297, 22, -8 }, // 2032 America/Godthab -> -2.00h
+    { 7297, 24, -4 }, // 2032 Atlantic/Azores -> -1.00h
+    { 7297, 26, 0 }, // 2032 Europe/London -> 0.00h
+    { 7297, 28, 4 }, // 2032 Europe/Brussels -> 1.00h
+    { 7297, 33, 8 }, // 2032 Europe/Tallinn -> 2.00h
+    { 7468, 18, -14 }, // 2032 America/St_Johns -> -3.50h
+    { 7468, 20, -12 }, // 2032 America/Miquelon -> -3.00h
+    { 7469, 13, -20 }, // 2032 America/Havana -> -5.00h
+    { 7469, 16, -16 }, // 2032 America/Thule -> -4.00h
+    { 7470, 14, -20 }, // 2032 America/Toronto -> -5.00h
+    { 7471, 10, -24 }, // 2032 America/Winnipeg -> -6.00h
+    { 7472, 8, -28 }, // 2032 America/Edmonton -> -7.00h
+    { 7473, 6, -32 }, // 2032 America/Vancouver -> -8.00h
+    { 7474, 5, -36 }, // 2032 America/Anchorage -> -9.00h
+    { 7475, 2, -40 }, // 2032 America/Adak -> -10.00h
+    { 1709, 13, -16 }, // 2033 America/Havana -> -4.00h
+    { 1709, 18, -10 }, // 2033 America/St_Johns -> -2.50h
+    { 1709, 20, -8 }, // 2033 America/Miquelon -> -2.00h
+    { 1710, 16, -12 }, // 2033 America/Thule -> -3.00h
+    { 1711, 14, -16 }, // 2033 America/Toronto -> -4.00h
+    { 1712, 10, -20 }, // 2033 America/Winnipeg -> -5.00h
+    { 1713, 8, -24 }, // 2033 America/Edmonton -> -6.00h
+    { 1714, 6, -28 }, // 2033 America/Vancouver -> -7.00h
+    { 1715, 5, -32 }, // 2033 America/Anchorage -> -8.00h
+    { 1716, 2, -36 }, // 2033 America/Adak -> -9.00h
+    { 1992, 30, 12 }, // 2033 Asia/Jerusalem -> 3.00h
+    { 2016, 34, 12 }, // 2033 Asia/Gaza -> 3.00h
+    { 2038, 31, 12 }, // 2033 Asia/Beirut -> 3.00h
+    { 2040, 32, 12 }, // 2033 Europe/Chisinau -> 3.00h
+    { 2041, 22, -4 }, // 2033 America/Godthab -> -1.00h
+    { 2041, 24, 0 }, // 2033 Atlantic/Azores -> 0.00h
+    { 2041, 26, 4 }, // 2033 Europe/London -> 1.00h
+    { 2041, 28, 8 }, // 2033 Europe/Brussels -> 2.00h
+    { 2041, 33, 12 }, // 2033 Europe/Tallinn -> 3.00h
+    { 2198, 56, 48 }, // 2033 Pacific/Auckland -> 12.00h
+    { 2198, 57, 51 }, // 2033 Pacific/Chatham -> 12.75h
+    { 2199, 52, 42 }, // 2033 Australia/Lord_Howe -> 10.50h
+    { 2199, 54, 44 }, // 2033 Pacific/Norfolk -> 11.00h
+    { 2200, 51, 40 }, // 2033 Australia/Hobart -> 10.00h
+    { 2201, 49, 38 }, // 2033 Australia/Adelaide -> 9.50h
+    { 2211, 11, -24 }, // 2033 Pacific/Easter -> -6.00h
+    { 2211, 17, -16 }, // 2033 America/Santiago -> -4.00h
+    { 2830, 35, 12 }, // 2033 Africa/Cairo -> 3.00h
+    { 5908, 11, -20 }, // 2033 Pacific/Easter -> -5.00h
+    { 5908, 17, -12 }, // 2033 America/Santiago -> -3.00h
+    { 6398, 56, 52 }, // 2033 Pacific/Auckland -> 13.00h
+    { 6398, 57, 55 }, // 2033 Pacific/Chatham -> 13.75h
+    { 6567, 54, 48 }, // 2033 Pacific/Norfolk -> 12.00h
+    { 6568, 49, 42 }, // 2033 Australia/Adelaide -> 10.50h
+    { 6568, 51, 44 }, // 2033 Australia/Hobart -> 11.00h
+    { 6568, 52, 44 }, // 2033 Australia/Lord_Howe -> 11.00h
+    { 7197, 35, 8 }, // 2033 Africa/Cairo -> 2.00h
+    { 7223, 34, 8 }, // 2033 Asia/Gaza -> 2.00h
+    { 7245, 31, 8 }, // 2033 Asia/Beirut -> 2.00h
+    { 7247, 30, 8 }, // 2033 Asia/Jerusalem -> 2.00h
+    { 7248, 32, 8 }, // 2033 Europe/Chisinau -> 2.00h
+    { 7249, 22, -8 }, // 2033 America/Godthab -> -2.00h
+    { 7249, 24, -4 }, // 2033 Atlantic/Azores -> -1.00h
+    { 7249, 26, 0 }, // 2033 Europe/London -> 0.00h
+    { 7249, 28, 4 }, // 2033 Europe/Brussels -> 1.00h
+    { 7249, 33, 8 }, // 2033 Europe/Tallinn -> 2.00h
+    { 7420, 18, -14 }, // 2033 America/St_Johns -> -3.50h
+    { 7420, 20, -12 }, // 2033 America/Miquelon -> -3.00h
+    { 7421, 13, -20 }, // 2033 America/Havana -> -5.00h
+    { 7421, 16, -16 }, // 2033 America/Thule -> -4.00h
+    { 7422, 14, -20 }, // 2033 America/Toronto -> -5.00h
+    { 7423, 10, -24 }, // 2033 America/Winnipeg -> -6.00h
+    { 7424, 8, -28 }, // 2033 America/Edmonton -> -7.00h
+    { 7425, 6, -32 }, // 2033 America/Vancouver -> -8.00h
+    { 7426, 5, -36 }, // 2033 America/Anchorage -> -9.00h
+    { 7427, 2, -40 }, // 2033 America/Adak -> -10.00h
+    { 1685, 13, -16 }, // 2034 America/Havana -> -4.00h
+    { 1685, 18, -10 }, // 2034 America/St_Johns -> -2.50h
+    { 1685, 20, -8 }, // 2034 America/Miquelon -> -2.00h
+    { 1686, 16, -12 }, // 2034 America/Thule -> -3.00h
+    { 1687, 14, -16 }, // 2034 America/Toronto -> -4.00h
+    { 1688, 10, -20 }, // 2034 America/Winnipeg -> -5.00h
+    { 1689, 8, -24 }, // 2034 America/Edmonton -> -6.00h
+    { 1690, 6, -28 }, // 2034 America/Vancouver -> -7.00h
+    { 1691, 5, -32 }, // 2034 America/Anchorage -> -8.00h
+    { 1692, 2, -36 }, // 2034 America/Adak -> -9.00h
+    { 1968, 30, 12 }, // 2034 Asia/Jerusalem -> 3.00h
+    { 1992, 34, 12 }, // 2034 Asia/Gaza -> 3.00h
+    { 2014, 31, 12 }, // 2034 Asia/Beirut -> 3.00h
+    { 2016, 32, 12 }, // 2034 Europe/Chisinau -> 3.00h
+    { 2017, 22, -4 }, // 2034 America/Godthab -> -1.00h
+    { 2017, 24, 0 }, // 2034 Atlantic/Azores -> 0.00h
+    { 2017, 26, 4 }, // 2034 Europe/London -> 1.00h
+    { 2017, 28, 8 }, // 2034 Europe/Brussels -> 2.00h
+    { 2017, 33, 12 }, // 2034 Europe/Tallinn -> 3.00h
+    { 2174, 56, 48 }, // 2034 Pacific/Auckland -> 12.00h
+    { 2174, 57, 51 }, // 2034 Pacific/Chatham -> 12.75h
+    { 2175, 52, 42 }, // 2034 Australia/Lord_Howe -> 10.50h
+    { 2175, 54, 44 }, // 2034 Pacific/Norfolk -> 11.00h
+    { 2176, 51, 40 }, // 2034 Australia/Hobart -> 10.00h
+    { 2177, 49, 38 }, // 2034 Australia/Adelaide -> 9.50h
+    { 2187, 11, -24 }, // 2034 Pacific/Easter -> -6.00h
+    { 2187, 17, -16 }, // 2034 America/Santiago -> -4.00h
+    { 2806, 35, 12 }, // 2034 Africa/Cairo -> 3.00h
+    { 5884, 11, -20 }, // 2034 Pacific/Easter -> -5.00h
+    { 5884, 17, -12 }, // 2034 America/Santiago -> -3.00h
+    { 6374, 56, 52 }, // 2034 Pacific/Auckland -> 13.00h
+    { 6374, 57, 55 }, // 2034 Pacific/Chatham -> 13.75h
+    { 6543, 54, 48 }, // 2034 Pacific/Norfolk -> 12.00h
+    { 6544, 49, 42 }, // 2034 Australia/Adelaide -> 10.50h
+    { 6544, 51, 44 }, // 2034 Australia/Hobart -> 11.00h
+    { 6544, 52, 44 }, // 2034 Australia/Lord_Howe -> 11.00h
+    { 7173, 35, 8 }, // 2034 Africa/Cairo -> 2.00h
+    { 7199, 34, 8 }, // 2034 Asia/Gaza -> 2.00h
+    { 7221, 31, 8 }, // 2034 Asia/Beirut -> 2.00h
+    { 7223, 30, 8 }, // 2034 Asia/Jerusalem -> 2.00h
+    { 7224, 32, 8 }, // 2034 Europe/Chisinau -> 2.00h
+    { 7225, 22, -8 }, // 2034 America/Godthab -> -2.00h
+    { 7225, 24, -4 }, // 2034 Atlantic/Azores -> -1.00h
+    { 7225, 26, 0 }, // 2034 Europe/London -> 0.00h
+    { 7225, 28, 4 }, // 2034 Europe/Brussels -> 1.00h
+    { 7225, 33, 8 }, // 2034 Europe/Tallinn -> 2.00h
+    { 7396, 18, -14 }, // 2034 America/St_Johns -> -3.50h
+    { 7396, 20, -12 }, // 2034 America/Miquelon -> -3.00h
+    { 7397, 13, -20 }, // 2034 America/Havana -> -5.00h
+    { 7397, 16, -16 }, // 2034 America/Thule -> -4.00h
+    { 7398, 14, -20 }, // 2034 America/Toronto -> -5.00h
+    { 7399, 10, -24 }, // 2034 America/Winnipeg -> -6.00h
+    { 7400, 8, -28 }, // 2034 America/Edmonton -> -7.00h
+    { 7401, 6, -32 }, // 2034 America/Vancouver -> -8.00h
+    { 7402, 5, -36 }, // 2034 America/Anchorage -> -9.00h
+    { 7403, 2, -40 }, // 2034 America/Adak -> -10.00h
+    { 1661, 13, -16 }, // 2035 America/Havana -> -4.00h
+    { 1661, 18, -10 }, // 2035 America/St_Johns -> -2.50h
+    { 1661, 20, -8 }, // 2035 America/Miquelon -> -2.00h
+    { 1662, 16, -12 }, // 2035 America/Thule -> -3.00h
+    { 1663, 14, -16 }, // 2035 America/Toronto -> -4.00h
+    { 1664, 10, -20 }, // 2035 America/Winnipeg -> -5.00h
+    { 1665, 8, -24 }, // 2035 America/Edmonton -> -6.00h
+    { 1666, 6, -28 }, // 2035 America/Vancouver -> -7.00h
+    { 1667, 5, -32 }, // 2035 America/Anchorage -> -8.00h
+    { 1668, 2, -36 }, // 2035 America/Adak -> -9.00h
+    { 1944, 30, 12 }, // 2035 Asia/Jerusalem -> 3.00h
+    { 1968, 34, 12 }, // 2035 Asia/Gaza -> 3.00h
+    { 1990, 31, 12 }, // 2035 Asia/Beirut -> 3.00h
+    { 1992, 32, 12 }, // 2035 Europe/Chisinau -> 3.00h
+    { 1993, 22, -4 }, // 2035 America/Godthab -> -1.00h
+    { 1993, 24, 0 }, // 2035 Atlantic/Azores -> 0.00h
+    { 1993, 26, 4 }, // 2035 Europe/London -> 1.00h
+    { 1993, 28, 8 }, // 2035 Europe/Brussels -> 2.00h
+    { 1993, 33, 12 }, // 2035 Europe/Tallinn -> 3.00h
+    { 2150, 56, 48 }, // 2035 Pacific/Auckland -> 12.00h
+    { 2150, 57, 51 }, // 2035 Pacific/Chatham -> 12.75h
+    { 2151, 52, 42 }, // 2035 Australia/Lord_Howe -> 10.50h
+    { 2151, 54, 44 }, // 2035 Pacific/Norfolk -> 11.00h
+    { 2152, 51, 40 }, // 2035 Australia/Hobart -> 10.00h
+    { 2153, 49, 38 }, // 2035 Australia/Adelaide -> 9.50h
+    { 2331, 11, -24 }, // 2035 Pacific/Easter -> -6.00h
+    { 2331, 17, -16 }, // 2035 America/Santiago -> -4.00h
+    { 2782, 35, 12 }, // 2035 Africa/Cairo -> 3.00h
+    { 5860, 11, -20 }, // 2035 Pacific/Easter -> -5.00h
+    { 5860, 17, -12 }, // 2035 America/Santiago -> -3.00h
+    { 6518, 56, 52 }, // 2035 Pacific/Auckland -> 13.00h
+    { 6518, 57, 55 }, // 2035 Pacific/Chatham -> 13.75h
+    { 6687, 54, 48 }, // 2035 Pacific/Norfolk -> 12.00h
+    { 6688, 49, 42 }, // 2035 Australia/Adelaide -> 10.50h
+    { 6688, 51, 44 }, // 2035 Australia/Hobart -> 11.00h
+    { 6688, 52, 44 }, // 2035 Australia/Lord_Howe -> 11.00h
+    { 7149, 35, 8 }, // 2035 Africa/Cairo -> 2.00h
+    { 7175, 34, 8 }, // 2035 Asia/Gaza -> 2.00h
+    { 7197, 31, 8 }, // 2035 Asia/Beirut -> 2.00h
+    { 7199, 30, 8 }, // 2035 Asia/Jerusalem -> 2.00h
+    { 7200, 32, 8 }, // 2035 Europe/Chisinau -> 2.00h
+    { 7201, 22, -8 }, // 2035 America/Godthab -> -2.00h
+    { 7201, 24, -4 }, // 2035 Atlantic/Azores -> -1.00h
+    { 7201, 26, 0 }, // 2035 Europe/London -> 0.00h
+    { 7201, 28, 4 }, // 2035 Europe/Brussels -> 1.00h
+    { 7201, 33, 8 }, // 2035 Europe/Tallinn -> 2.00h
+    { 7372, 18, -14 }, // 2035 America/St_Johns -> -3.50h
+    { 7372, 20, -12 }, // 2035 America/Miquelon -> -3.00h
+    { 7373, 13, -20 }, // 2035 America/Havana -> -5.00h
+    { 7373, 16, -16 }, // 2035 America/Thule -> -4.00h
+    { 7374, 14, -20 }, // 2035 America/Toronto -> -5.00h
+    { 7375, 10, -24 }, // 2035 America/Winnipeg -> -6.00h
+    { 7376, 8, -28 }, // 2035 America/Edmonton -> -7.00h
+    { 7377, 6, -32 }, // 2035 America/Vancouver -> -8.00h
+    { 7378, 5, -36 }, // 2035 America/Anchorage -> -9.00h
+    { 7379, 2, -40 }, // 2035 America/Adak -> -10.00h
 };
 
-#define AIRPORT_TZ_LIST_COUNT (sizeof(airport_tz_list)/sizeof(airport_tz_list[0]))
+// One row per year plus a closing sentinel
+static const TzYear airport_tz_years[] = {
+    { 1735689600, 0 }, // 2025
+    { 1767225600, 64 }, // 2026
+    { 1798761600, 120 }, // 2027
+    { 1830297600, 176 }, // 2028
+    { 1861920000, 232 }, // 2029
+    { 1893456000, 288 }, // 2030
+    { 1924992000, 344 }, // 2031
+    { 1956528000, 400 }, // 2032
+    { 1988150400, 456 }, // 2033
+    { 2019686400, 512 }, // 2034
+    { 2051222400, 568 }, // 2035
+    { 2082758400, 624 }, // end
+};
+
+// Buckets, codes and names live in airport_data.bin
+#define AIRPORT_DATA_RESOURCE RESOURCE_ID_AIRPORT_DATA
+#define AIRPORT_DATA_VERSION 1
+#define AIRPORT_DATA_BYTES 8111
+#define AIRPORT_TZ_LIST_COUNT 60
 #define AIRPORT_CODE_POOL_COUNT 409
 #define AIRPORT_NAME_POOL_COUNT 409
+#define AIRPORT_NAME_POOL_BYTES 5321
+#define AIRPORT_NAME_MAX_LEN 52
+#define AIRPORT_TZ_EVENT_COUNT 624
+#define AIRPORT_TZ_FIRST_YEAR 2025
+#define AIRPORT_TZ_YEAR_COUNT 11
+
+// Identifies this bucket table to the phone schedule (src/pkjs/schedule.js)
+#define AIRPORT_DATA_CHECKSUM 0xd2e0c791u
+
+// Data footprint, printed per platform by wscript
+#define AIRPORT_DATA_TIER "full"
+#define AIRPORT_DATA_FLASH_BYTES 2592
+#define AIRPORT_DATA_RAM_BYTES 415
@@ -1,34 +1,12 @@
 #include "clock_beat.h"
 #include <pebble.h> // Always include pebble for device builds
-#include <stdint.h> // For uint32_t, uint64_t
-#include <time.h>   // For time_t
 #include <stdio.h>  // For snprintf
-#include "text_layer_util.h"
-
-#define HOUR_LENGTH 3600
-#define DAY_LENGTH 86400
 
 // --- Static variables specific to Beat Clock ---
 static char s_beat_buffer[7];   // Buffer for Beat time string "@XXX.X"
 static int last_beat_time = -1; // Cache the last displayed beat time (multiplied by 10)
 
 // --- Static helper function ---
-/**
- * Computes the current .beat time * 10 (0-9999)
- */
-static int beat(time_t current_seconds_utc) {
-  time_t now_bmt = current_seconds_utc + HOUR_LENGTH;
-  // Ensure calculations use appropriate types to avoid overflow/truncation
-  // Use uint64_t for multiplication before division
-  uint64_t seconds_in_day = (uint64_t)(now_bmt % DAY_LENGTH);
-  // Ensure division by DAY_LENGTH is done carefully
-  int b = (int)((seconds_in_day * 10000ULL) / DAY_LENGTH);
-  // Clamp the value just in case of edge issues
-  if (b < 0) b = 0;
-  if (b > 9999) b = 9999;
-  return b;
-}
-
 /**
  * Calculates the Beat time string and writes it to the buffer.
  */
@@ -40,20 +18,23 @@ static void format_beat_time_string(char* buffer, size_t buffer_size, int b) {
 
 // --- Pebble UI Interface Functions ---
 
-TextLayer* clock_beat_init(GRect bounds, Layer *window_layer) {
-    return text_layer_util_create(bounds, window_layer, "@--.-", FONT_KEY_GOTHIC_24_BOLD);
+FaceText* clock_beat_init(GRect bounds) {
+    last_beat_time = -1;
+    return face_text_create(bounds, "@--.-", FONT_KEY_GOTHIC_24_BOLD);
 }
 
-void clock_beat_deinit(TextLayer *layer) {
-    if (layer) {
-        text_layer_destroy(layer);
-    }
+void clock_beat_deinit(FaceText *text) {
+    face_text_destroy(text);
 }
 
-void clock_beat_update(TextLayer *layer, time_t current_seconds_utc) {
-    if (!layer) return;
+void clock_beat_update(FaceText *text, const UtcTime *now) {
+    if (!text || !now) return;
 
-    int b = beat(current_seconds_utc);
+    // .beat time * 10 (0-9999), integer-only
+    int b = time_math_beat10(now->sod);
+    // Clamp the value just in case of edge issues (and so "@XXX.X" provably fits)
+    if (b < 0) b = 0;
+    if (b > 9999) b = 9999;
 
     // Check cache *before* formatting to prevent redundant UI updates
     if (b == last_beat_time) {
@@ -63,6 +44,20 @@ void clock_beat_update(TextLayer *layer, time_t current_seconds_utc) {
     // Use the helper to format the string into the static buffer
     format_beat_time_string(s_beat_buffer, sizeof(s_beat_buffer), b);
 
-    text_layer_set_text(layer, s_beat_buffer);
+    face_text_set_text(text, s_beat_buffer);
     last_beat_time = b;
 }
+
+void clock_beat_hide(FaceText *text) {
+    face_text_set_text(text, "");
+    last_beat_time = -1; // redraw even if the beat has not moved
+}
+
+time_t clock_beat_next_change(const UtcTime *now) {
+    int32_t bmt = now->sod + (int32_t)TM_HOUR_SECONDS;
+    if (bmt >= TM_DAY_SECONDS) bmt -= TM_DAY_SECONDS;
+    // First Biel second of the next tenth of a beat; 10000 wraps to midnight
+    int next = time_math_beat10(now->sod) + 1;
+    int32_t next_bmt = (next * 216 + 24) / 25;
+    return now->utc + (next_bmt - bmt);
+}
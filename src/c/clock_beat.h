@@ -3,14 +3,22 @@
 
 #include <pebble.h>
 #include <stddef.h> // For size_t
+#include "face_layer.h"
+#include "time_math.h"
 
-// Initializes the Beat clock layer
-TextLayer* clock_beat_init(GRect bounds, Layer *window_layer);
+// Initializes the Beat clock field
+FaceText* clock_beat_init(GRect bounds);
 
-// Deinitializes the Beat clock layer
-void clock_beat_deinit(TextLayer *layer);
+// Deinitializes the Beat clock field
+void clock_beat_deinit(FaceText *text);
 
-// Updates the Beat clock layer
-void clock_beat_update(TextLayer *layer, time_t current_seconds_utc);
+// Updates the Beat clock field
+void clock_beat_update(FaceText *text, const UtcTime *now);
+
+// Blanks the Beat clock field until the next update
+void clock_beat_hide(FaceText *text);
+
+// UTC second at which the displayed beat next changes (every 8.64 s)
+time_t clock_beat_next_change(const UtcTime *now);
 
 #endif // CLOCK_BEAT_H
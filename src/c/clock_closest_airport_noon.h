@@ -5,18 +5,31 @@
 // IATA code of a randomly-chosen airport whose local time is the *closest past
 // but not before* 12:00:00 (noon) relative to the current UTC.  The
 // underlying data come from the generated `airport_tz_list.c`, which is built
-// by `generateAirportTzList.ts`.
+// by `generateAirportTzList.ts`; by default the buckets, codes and names are
+// in the `AIRPORT_DATA` resource it writes alongside.
 //
 // The public interface mirrors `clock_closest_noon.h`, so you can swap calls
 // easily in `watchface.c`.
 //
-//  • clock_closest_airport_noon_code_init   – returns a TextLayer* for the IATA
+//  • clock_closest_airport_noon_code_init   – returns a FaceText* for the IATA
 //    display (3- or 4-char string).
-//  • clock_closest_airport_noon_time_init   – returns a TextLayer* for the
+//  • clock_closest_airport_noon_time_init   – returns a FaceText* for the
 //    hero minutes : seconds display.
 //  • clock_closest_airport_noon_update      – to be called once per second with
-//    the current UTC epoch (as provided by Pebble's `time_ms`).
+//    the tick's `UtcTime` (see `time_math.h`).
+//  • clock_closest_airport_noon_next_change – UTC second of the next visible
+//    change, for the wakeup scheduler in `watchface.c`.
+//  • clock_closest_airport_noon_set_seconds  – hero as MM:SS (default) or
+//    minutes only, changing once a minute (battery saving).
 //  • clock_closest_airport_noon_deinit      – cleanup helper.
+//  • clock_closest_airport_noon_get_selection / _restore_selection – export
+//    and re-apply the current pick, so a warm start can skip the scan.
+//  • clock_closest_airport_noon_set_strip / _refresh_strip / _strip_code –
+//    extra "world strip" targets, evaluated in the same pass as the hero (or
+//    on their own at the hero's instant), and their codes.
+//  • clock_closest_airport_noon_set_schedule / _schedule_until /
+//    _schedule_request – hero picks precomputed by the phone (see
+//    src/pkjs/schedule.js), used instead of the sweep while they cover now.
 //
 // Implementation note: The whole logic is declared `static inline` so that the
 // header can be included in just one translation unit (e.g. `watchface.c`) and
@@ -25,47 +38,265 @@
 
 #include <pebble.h>
 #include <stdint.h>
-#include <stdlib.h>   // rand, srand
 #include <stdbool.h>
 #include <time.h>
 #include <limits.h>
 #include <string.h>
-#include "text_layer_util.h"
+#include "face_layer.h"
+#include "time_math.h"
+#include "selection_history.h"
 
 // Bring in the generated data table; make sure the build has already executed
-// generate_airport_tz_list.py.
+// generate_airport_tz_list.py.  wscript points AIRPORT_TZ_LIST_FILE at the
+// platform's data tier (scripts/dataTiers.json) when it has its own variant.
+#ifdef AIRPORT_TZ_LIST_FILE
+#include AIRPORT_TZ_LIST_FILE
+#else
 #include "airport_tz_list.c"
-#define NAME_POOL           airport_name_pool
-#define TZ_LIST             airport_tz_list
+#endif
 #define TZ_LIST_COUNT       AIRPORT_TZ_LIST_COUNT
-// Bit-packed IATA code pool (15-bits per entry)
-extern const uint16_t airport_code_pool_bits[];
+
+// Bucket indices are uint8_t everywhere: the sorted order and its runs, the
+// phone schedule (0xFF = no bucket), the warm-start snapshot and the history
+_Static_assert(TZ_LIST_COUNT < 0xFF, "airport data has too many buckets for 8-bit bucket indices");
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// Helper to fetch the Nth null-terminated name from the flat pool
-static inline const char* _airport_flat_name(const char* pool, int nameIndex) {
-    const char* p = pool;
-    while (nameIndex-- > 0) {
-        while (*p) p++; // skip current string
-        p++;            // move past '\0'
+#ifdef AIRPORT_DATA_RESOURCE
+// Airport data resource (see scripts/airportDataResource.ts).  Only the
+// bucket table is copied into RAM, by clock_closest_airport_noon_code_init();
+// the picked airport's code and name are fetched with
+// resource_load_byte_range() once per re-eval.
+#define TZ_STD_QUARTERS           s_tz_std_quarters
+#define TZ_NAME_START             s_tz_name_start
+#define AIRPORT_DATA_MAGIC        "ATZD"
+#define AIRPORT_DATA_BUCKET_BYTES 5
+
+// Resource header, little-endian like the watch itself
+typedef struct __attribute__((packed)) {
+    char     magic[4];          // AIRPORT_DATA_MAGIC
+    uint16_t version;           // AIRPORT_DATA_VERSION
+    uint16_t bucket_count;
+    uint16_t code_count;
+    uint16_t name_max_len;      // longest name in bytes
+    uint32_t buckets_offset;    // 5-byte bucket rows
+    uint32_t codes_offset;      // uint16 packed IATA codes
+    uint32_t name_index_offset; // uint32 name offsets, code_count + 1 of them
+    uint32_t names_offset;      // UTF-8 names back to back
+    uint32_t names_bytes;
+} AirportDataHeader;
+
+static int8_t            s_tz_std_quarters[TZ_LIST_COUNT];
+static uint16_t          s_tz_name_start[TZ_LIST_COUNT + 1];
+static AirportDataHeader s_airport_data;
+static ResHandle         s_airport_res;
+static bool              s_airport_data_ok = false;
+static char              s_name_buf[AIRPORT_NAME_MAX_LEN + 1];
+
+static inline uint32_t _airport_rd32(const uint8_t *p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Reads and checks the header, then loads the bucket table. Returns false
+// (and the face shows no pick) if the resource does not match this build.
+static inline bool _airport_data_load(void) {
+    if (s_airport_data_ok) return true;
+    s_airport_res = resource_get_handle(AIRPORT_DATA_RESOURCE);
+    if (!s_airport_res) return false;
+    if (resource_load_byte_range(s_airport_res, 0, (uint8_t *)&s_airport_data,
+                                 sizeof(s_airport_data)) != sizeof(s_airport_data)) return false;
+    if (memcmp(s_airport_data.magic, AIRPORT_DATA_MAGIC, 4) != 0 ||
+        s_airport_data.version != AIRPORT_DATA_VERSION ||
+        s_airport_data.bucket_count != TZ_LIST_COUNT ||
+        s_airport_data.code_count != AIRPORT_CODE_POOL_COUNT ||
+        s_airport_data.name_max_len > AIRPORT_NAME_MAX_LEN) return false;
+
+    uint8_t rows[TZ_LIST_COUNT * AIRPORT_DATA_BUCKET_BYTES];
+    if (resource_load_byte_range(s_airport_res, s_airport_data.buckets_offset,
+                                 rows, sizeof(rows)) != sizeof(rows)) return false;
+    // Rows hold std, dst, name offset and count; the watch keeps the std
+    // offset and the name ranges, which must be back to back
+    uint16_t next = 0;
+    for (int i = 0; i < (int)TZ_LIST_COUNT; ++i) {
+        const uint8_t *r = &rows[i * AIRPORT_DATA_BUCKET_BYTES];
+        if ((uint16_t)(r[2] | (r[3] << 8)) != next) return false;
+        s_tz_std_quarters[i] = (int8_t)r[0];
+        s_tz_name_start[i]   = next;
+        next += r[4];
+    }
+    s_tz_name_start[TZ_LIST_COUNT] = next;
+    s_airport_data_ok = true;
+    return true;
+}
+
+// Bit-packed IATA code (15 bits) of the Nth airport
+static inline uint16_t _airport_code_bits(int codeIndex) {
+    uint8_t b[2] = { 0, 0 };
+    resource_load_byte_range(s_airport_res, s_airport_data.codes_offset + 2u * (uint32_t)codeIndex, b, 2);
+    return (uint16_t)(b[0] | (b[1] << 8));
+}
+
+// Name of the Nth airport, read into a scratch buffer
+static inline const char* _airport_name(int nameIndex) {
+    uint8_t idx[8];
+    size_t len = 0;
+    if (resource_load_byte_range(s_airport_res, s_airport_data.name_index_offset + 4u * (uint32_t)nameIndex,
+                                 idx, sizeof(idx)) == sizeof(idx)) {
+        uint32_t start = _airport_rd32(idx);
+        uint32_t end   = _airport_rd32(idx + 4);
+        len = end > start ? end - start : 0;
+        if (len > AIRPORT_NAME_MAX_LEN) len = AIRPORT_NAME_MAX_LEN;
+        len = resource_load_byte_range(s_airport_res, s_airport_data.names_offset + start,
+                                       (uint8_t *)s_name_buf, len);
     }
-    return p;
+    s_name_buf[len] = '\0';
+    return s_name_buf;
+}
+#else
+#define NAME_POOL           airport_name_pool
+#define NAME_OFFSETS        airport_name_offsets
+#define TZ_STD_QUARTERS     airport_tz_std_quarters
+#define TZ_NAME_START       airport_tz_name_start
+// Bit-packed IATA code pool (15-bits per entry)
+extern const uint16_t airport_code_pool_bits[];
+
+#ifdef AIRPORT_NAME_HUFF_MAX_BITS
+// Huffman-coded pool: NAME_OFFSETS hold bit offsets. Only the selected name
+// is decoded, once per re-eval, into this scratch buffer.
+static char s_name_buf[AIRPORT_NAME_MAX_LEN + 1];
+
+static inline const char* _airport_flat_name(const uint8_t* pool, int nameIndex) {
+    uint32_t pos = NAME_OFFSETS[nameIndex];
+    size_t len = 0;
+    for (;;) {
+        // Canonical decode: walk code lengths until the code falls in range
+        int code = 0, first = 0, index = 0, symbol = 0;
+        for (int bits = 1; bits <= AIRPORT_NAME_HUFF_MAX_BITS; bits++) {
+            code |= (pool[pos >> 3] >> (7 - (pos & 7))) & 1;
+            pos++;
+            int count = airport_name_huff_counts[bits];
+            if (code - first < count) {
+                symbol = airport_name_huff_symbols[index + code - first];
+                break;
+            }
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        if (symbol == 0 || len >= AIRPORT_NAME_MAX_LEN) break;
+        s_name_buf[len++] = (char)symbol;
+    }
+    s_name_buf[len] = '\0';
+    return s_name_buf;
+}
+#else
+// Helper to fetch the Nth null-terminated name from the flat pool, in
+// constant time through the generated offset index
+static inline const char* _airport_flat_name(const char* pool, int nameIndex) {
+    return pool + NAME_OFFSETS[nameIndex];
+}
+#endif
+
+// The tables are linked in, nothing to load
+static inline bool _airport_data_load(void) {
+    return true;
+}
+
+static inline uint16_t _airport_code_bits(int codeIndex) {
+    return airport_code_pool_bits[codeIndex];
+}
+
+static inline const char* _airport_name(int nameIndex) {
+    return _airport_flat_name(NAME_POOL, nameIndex);
+}
+#endif // AIRPORT_DATA_RESOURCE
+
+// The bucket table is split by access: std offsets are read only when the
+// active offsets are reset, name ranges only for picked buckets.  Bucket i
+// owns codes [TZ_NAME_START[i], TZ_NAME_START[i + 1]).
+static inline int _airport_name_first(int idx) {
+    return TZ_NAME_START[idx];
+}
+
+static inline int _airport_name_count(int idx) {
+    return TZ_NAME_START[idx + 1] - TZ_NAME_START[idx];
 }
 
 // Public API ---------------------------------------------------------------
 
-static inline TextLayer* clock_closest_airport_noon_code_init(GRect bounds,
-                                                              Layer *window_layer);
-static inline TextLayer* clock_closest_airport_noon_time_init(GRect bounds,
-                                                              Layer *window_layer);
-static inline void       clock_closest_airport_noon_deinit(TextLayer *layer);
-static inline void       clock_closest_airport_noon_update(TextLayer *code_layer,
-                                                           TextLayer *time_layer,
-                                                           time_t     current_utc_t,
-                                                           long       target_seconds_of_day);
+static inline FaceText* clock_closest_airport_noon_code_init(GRect bounds);
+static inline FaceText* clock_closest_airport_noon_time_init(GRect bounds);
+static inline void      clock_closest_airport_noon_deinit(FaceText *text);
+static inline void      clock_closest_airport_noon_update(FaceText *code_text,
+                                                          FaceText *time_text,
+                                                          const UtcTime *now,
+                                                          long      target_seconds_of_day);
+static inline time_t    clock_closest_airport_noon_next_change(const UtcTime *now);
+static inline void      clock_closest_airport_noon_set_seconds(bool show_seconds);
+
+// World strip: up to AIRPORT_STRIP_MAX extra targets, picked in the same pass
+// as the hero.  Takes effect on the next evaluation, or on refresh_strip.
+#define AIRPORT_STRIP_MAX   3
+static inline void        clock_closest_airport_noon_set_strip(const long *targets_seconds_of_day,
+                                                               int         count);
+static inline void        clock_closest_airport_noon_refresh_strip(void);
+static inline const char* clock_closest_airport_noon_strip_code(int row);
+
+// Compact record of the current pick, persisted across launches; the pick is
+// a SelectionRecord like the entries of the selection history
+typedef struct __attribute__((packed)) {
+    int32_t         eval_time;        // UTC of the evaluation that produced it
+    SelectionRecord pick;             // bucket and name index, slot_delta 0
+    int8_t          offset_quarters;  // offset shown for the pick, 0.25h units
+    uint8_t         target_quarters;  // target_seconds_of_day in 0.25h units
+} AirportSelection;
+
+static inline bool      clock_closest_airport_noon_get_selection(AirportSelection *out);
+static inline bool      clock_closest_airport_noon_restore_selection(const AirportSelection *sel,
+                                                                     time_t current_utc_t,
+                                                                     long   target_seconds_of_day);
+
+// Phone schedule: the hero pick of every :00/:15/:30 slot for up to 48h,
+// computed by the phone from its own tz database for this build's bucket
+// table (AIRPORT_DATA_CHECKSUM).  Wire format, little-endian, mirrored by
+// src/pkjs/schedule.js; the watch persists it as received.
+#define AIRPORT_SCHEDULE_VERSION        1
+#define AIRPORT_SCHEDULE_SLOTS_PER_HOUR 3     // :00, :15, :30 (:45 belongs to :30)
+#define AIRPORT_SCHEDULE_SLOTS_MAX      (48 * AIRPORT_SCHEDULE_SLOTS_PER_HOUR)
+#define AIRPORT_SCHEDULE_NONE           0xFF  // no bucket reached the target
+
+typedef struct __attribute__((packed)) {
+    uint8_t  bucket;           // index into airport_tz_list, or AIRPORT_SCHEDULE_NONE
+    int8_t   offset_quarters;  // the bucket's offset in that slot, 0.25h units
+} AirportScheduleSlot;
+
+typedef struct __attribute__((packed)) {
+    uint8_t  version;          // AIRPORT_SCHEDULE_VERSION
+    uint8_t  target_quarters;  // target the picks were made for
+    uint8_t  slot_count;       // entries in `slots`
+    uint8_t  bucket_count;     // TZ_LIST_COUNT it was computed against
+    uint32_t data_checksum;    // AIRPORT_DATA_CHECKSUM it was computed against
+    int32_t  first_slot_utc;   // UTC of slots[0], on a whole hour
+    AirportScheduleSlot slots[AIRPORT_SCHEDULE_SLOTS_MAX];
+} AirportSchedule;
+
+// Sent to the phone to ask for a schedule
+typedef struct __attribute__((packed)) {
+    uint8_t  version;          // AIRPORT_SCHEDULE_VERSION
+    uint8_t  target_quarters;
+    uint8_t  slot_count;       // slots wanted
+    uint8_t  bucket_count;
+    uint32_t data_checksum;
+} AirportScheduleRequest;
+
+#define AIRPORT_SCHEDULE_HEADER_BYTES (sizeof(AirportSchedule) - sizeof(((AirportSchedule *)0)->slots))
+
+static inline bool   clock_closest_airport_noon_set_schedule(const uint8_t *data, size_t length);
+static inline time_t clock_closest_airport_noon_schedule_until(long target_seconds_of_day);
+static inline bool   clock_closest_airport_noon_schedule_request(AirportScheduleRequest *out,
+                                                                 long target_seconds_of_day);
 // -------------------------------------------------------------------------
 
 // Internal constants / storage --------------------------------------------
@@ -75,111 +306,459 @@ static time_t s_last_update_time        = -1;
 static time_t s_last_re_eval_time       = -1;
 static char s_selected_code[4]          = "---";  // IATA placeholder
 static const char *s_selected_name      = "---";  // Airport name placeholder
-static float s_selected_offset_hours    = 0.0f;
+static int  s_selected_offset_quarters  = 0;      // 0.25h units
+static int  s_selected_bucket           = -1;     // -1 while nothing is picked
+static int  s_selected_name_index       = 0;
+static long s_selected_target           = 0;
+static char s_hero_time[6]              = "--:--"; // hero MM:SS (or MM) as last shown
+static bool s_hero_seconds              = true;
+
+// World strip rows
+#define AIRPORT_TARGETS_MAX (1 + AIRPORT_STRIP_MAX)  // hero first
+
+typedef struct {
+    int bucket;           // -1 if no bucket has reached the target
+    int name_index;
+    int offset_quarters;
+} AirportPick;
+
+static int  s_strip_count = 0;
+static long s_strip_target[AIRPORT_STRIP_MAX];
+static char s_strip_code[AIRPORT_STRIP_MAX][4];
+static int  s_strip_bucket[AIRPORT_STRIP_MAX];
+static int  s_strip_offset_quarters[AIRPORT_STRIP_MAX];
 
-// Helper: determine if DST is active for a TzInfo at current UTC
-static inline bool _airport_is_dst(const TzInfo *tz, int64_t now_utc) {
-  if (tz->dst_start_utc == 0 && tz->dst_end_utc == 0) return false;
-  if (tz->dst_start_utc <= tz->dst_end_utc) {
-      return (now_utc >= tz->dst_start_utc && now_utc < tz->dst_end_utc);
-  }
-  // southern hemisphere wrap-around
-  return (now_utc >= tz->dst_start_utc || now_utc < tz->dst_end_utc);
+// Bucket offset state ------------------------------------------------------
+// Current offset of every bucket, kept up to date by walking the generated DST
+// event table.  Events are delta-encoded per year (hours since that year's
+// UTC start, see `airport_tz_years`) and sorted by time, so one cursor covers
+// the whole multi-year range.  Every bucket starts the table on its std offset
+// (southern-hemisphere buckets get an hour-0 event); repositioning the cursor
+// (on first use, or when the clock jumps backwards) replays the events up to
+// `now`.  Everything else reads `s_bucket_quarters` directly.
+#define TZ_EVENTS           airport_tz_events
+#define TZ_EVENT_COUNT      AIRPORT_TZ_EVENT_COUNT
+#define TZ_YEARS            airport_tz_years
+#define TZ_YEAR_COUNT       AIRPORT_TZ_YEAR_COUNT
+#define TIME_T_MAX          ((time_t)INT32_MAX)
+
+static int8_t  s_bucket_quarters[TZ_LIST_COUNT];  // active offset, 0.25h units
+static int     s_event_cursor     = 0;            // next event to apply
+static int     s_event_year       = 0;            // table year of that event
+static time_t  s_next_event_utc   = TIME_T_MAX;   // instant of that event
+static time_t  s_offsets_time     = -1;           // instant the state reflects
+
+// Resolve the year and absolute instant of the event under the cursor
+static inline void _airport_cursor_load(void) {
+    if (s_event_cursor >= (int)TZ_EVENT_COUNT) {
+        s_next_event_utc = TIME_T_MAX;
+        return;
+    }
+    while (s_event_year + 1 < (int)TZ_YEAR_COUNT &&
+           s_event_cursor >= TZ_YEARS[s_event_year + 1].first_event) {
+        s_event_year++;
+    }
+    s_next_event_utc = (time_t)TZ_YEARS[s_event_year].start_utc +
+                       (time_t)TZ_EVENTS[s_event_cursor].hour * 3600;
+}
+
+static inline void _airport_offsets_reset(void) {
+    for (int i = 0; i < (int)TZ_LIST_COUNT; ++i) {
+        s_bucket_quarters[i] = TZ_STD_QUARTERS[i];
+    }
+    s_event_cursor = 0;
+    s_event_year = 0;
+    _airport_cursor_load();
 }
 
-static inline void _airport_pick_new(time_t current_utc_t, long target_seconds_of_day) {
-    srand((unsigned int)current_utc_t);  // stable randomness per eval moment
+// Bring s_bucket_quarters up to date for `now`.
+static inline void _airport_offsets_advance(time_t now) {
+    if (s_offsets_time < 0 || now < s_offsets_time) {
+        _airport_offsets_reset();
+    }
+    while (s_next_event_utc <= now) {
+        const TzEvent *ev = &TZ_EVENTS[s_event_cursor++];
+        s_bucket_quarters[ev->bucket] = ev->quarters;
+        _airport_cursor_load();
+    }
+    s_offsets_time = now;
+}
+
+// Instant of the next offset change after the last advance, or TIME_T_MAX.
+static inline time_t _airport_offsets_next_change(void) {
+    return s_next_event_utc;
+}
+
+// Sorted bucket order -----------------------------------------------------
+// Sorting the buckets by their active offset modulo 24h orders them by local
+// time for every UTC instant, up to a rotation: the buckets whose local time
+// has wrapped past midnight come first.  Each target's winner set is then one
+// contiguous run of that order, and targets taken in ascending order find
+// their runs in a single merge pass, so the cost grows with the number of
+// buckets plus the number of targets.  The order only changes with a DST
+// event.
+#define SLOT_SECONDS        (15 * 60L)
+#define QUARTERS_PER_DAY    96
 
-    uint32_t utc_secs = current_utc_t % DAY_SECONDS;
-    long best_delta = LONG_MAX;
-    int  best_count = 0;
-    int  best_candidates[TZ_LIST_COUNT];
+static uint8_t s_order[TZ_LIST_COUNT];    // bucket indices sorted by day-offset
+static uint8_t s_order_q[TZ_LIST_COUNT];  // day-offset of every bucket, 0..95 quarters
+static time_t  s_order_valid_from  = -1;
+static time_t  s_order_valid_until = -1;
 
-    // 1. Scan every timezone bucket to find the one(s) whose local time is >=12:00
-    //    and *closest* to exactly noon.
+// Winners of one target: a run of s_order (count 0 = none)
+typedef struct {
+    uint8_t first;
+    uint8_t count;
+} AirportRun;
+
+static inline void _airport_order_build(time_t now) {
+    // 1. Active offsets (already advanced to `now`) modulo 24h
     for (int i = 0; i < (int)TZ_LIST_COUNT; ++i) {
-        const TzInfo *tz = &TZ_LIST[i];
-        bool is_dst = _airport_is_dst(tz, (int64_t)current_utc_t);
-        // reconstruct hours from quarter-hour units
-        float offset_h = (is_dst ? tz->dst_quarters : tz->std_quarters) * 0.25f;
-        long local_secs = (long)utc_secs + (long)(offset_h * 3600.0f);
-        local_secs %= DAY_SECONDS;
-        if (local_secs < 0) local_secs += DAY_SECONDS;
-        if (local_secs < target_seconds_of_day) continue;   // hasn't reached target time yet
-        long delta = local_secs - target_seconds_of_day;
-        if (delta < best_delta) {
-            best_delta = delta;
-            best_count = 0;
-            best_candidates[best_count++] = i;
-        } else if (delta == best_delta && best_count < (int)TZ_LIST_COUNT) {
-            best_candidates[best_count++] = i;
+        int q = s_bucket_quarters[i] % QUARTERS_PER_DAY;
+        s_order_q[i] = (uint8_t)(q < 0 ? q + QUARTERS_PER_DAY : q);
+    }
+
+    // 2. Stable insertion sort by day-offset, so ties keep table order
+    for (int i = 0; i < (int)TZ_LIST_COUNT; ++i) {
+        int j = i;
+        while (j > 0 && s_order_q[s_order[j - 1]] > s_order_q[i]) {
+            s_order[j] = s_order[j - 1];
+            j--;
         }
+        s_order[j] = (uint8_t)i;
     }
 
-    // 2. Pick a random candidate, then a random airport code from that bucket
-    if (best_count == 0) {
+    s_order_valid_from  = now;
+    s_order_valid_until = _airport_offsets_next_change();
+}
+
+// For every target, find the run of buckets whose local time is >= target
+// and *closest* to it.  One walk over the rotated order serves all targets.
+static inline void _airport_sweep(time_t current_utc_t, const long *targets, int count,
+                                  AirportRun *runs) {
+    int32_t utc_secs = time_math_utc_sod(current_utc_t);
+
+    // 1. Visit the targets in ascending order
+    uint8_t by_target[AIRPORT_TARGETS_MAX];
+    for (int t = 0; t < count; ++t) {
+        int j = t;
+        while (j > 0 && targets[by_target[j - 1]] > targets[t]) {
+            by_target[j] = by_target[j - 1];
+            j--;
+        }
+        by_target[j] = (uint8_t)t;
+    }
+
+    // 2. Local-time order starts at the first bucket that wrapped past
+    //    midnight (runs never straddle it: equal offsets wrap together)
+    int start = 0;
+    while (start < (int)TZ_LIST_COUNT &&
+           utc_secs + s_order_q[s_order[start]] * SLOT_SECONDS < DAY_SECONDS) start++;
+    if (start == (int)TZ_LIST_COUNT) start = 0;
+
+    // 3. Merge: skip buckets that haven't reached the next target yet
+    int k = 0;
+    for (int n = 0; n < count; ++n) {
+        int t = by_target[n];
+        while (k < (int)TZ_LIST_COUNT) {
+            uint8_t q = s_order_q[s_order[(start + k) % TZ_LIST_COUNT]];
+            if ((utc_secs + q * SLOT_SECONDS) % DAY_SECONDS >= targets[t]) break;
+            k++;
+        }
+        if (k == (int)TZ_LIST_COUNT) {
+            runs[t].first = 0;
+            runs[t].count = 0;
+            continue;
+        }
+        int first = (start + k) % TZ_LIST_COUNT;
+        int end = first + 1;
+        while (end < (int)TZ_LIST_COUNT && s_order_q[s_order[end]] == s_order_q[s_order[first]]) end++;
+        runs[t].first = (uint8_t)first;
+        runs[t].count = (uint8_t)(end - first);
+    }
+}
+// Selection hash -----------------------------------------------------------
+// A pick is a pure function of the evaluation instant: splitmix32 of the
+// instant, one stream per choice (two per target), reduced to [0, count) by multiply-shift.
+// No global generator is touched, so the same slot always yields the same
+// airport and other modules' randomness is unaffected.
+#define PICK_STREAM_BUCKET  0u
+#define PICK_STREAM_NAME    1u
+#define PICK_STREAMS_PER_TARGET 2u
+
+static inline uint32_t _airport_splitmix32(uint32_t x) {
+    x += 0x9e3779b9u;
+    x = (x ^ (x >> 16)) * 0x85ebca6bu;
+    x = (x ^ (x >> 13)) * 0xc2b2ae35u;
+    return x ^ (x >> 16);
+}
+
+// Index in [0, count) for choice `stream` of the evaluation at `slot_time`
+static inline int _airport_pick(time_t slot_time, uint32_t stream, int count) {
+    if (count <= 1) return 0;
+    uint32_t h = _airport_splitmix32((uint32_t)slot_time ^ (stream * 0x632be5abu));
+    return (int)(((uint64_t)h * (uint32_t)count) >> 32);
+}
+
+// Unpack the 3-letter code of airport `ni` in bucket `idx` from its
+// bit-packed 15-bit entry
+static inline void _airport_code(char *out, int idx, int ni) {
+    uint16_t bits = _airport_code_bits(_airport_name_first(idx) + ni);
+    out[0] = 'A' + ((bits >> 10) & 0x1F);
+    out[1] = 'A' + ((bits >> 5) & 0x1F);
+    out[2] = 'A' + ( bits        & 0x1F);
+    out[3] = '\0';
+}
+
+// Apply a pick: bucket `idx` (or -1 for none), airport `ni` within it, shown
+// with the given offset.
+static inline void _airport_select(int idx, int ni, int offset_quarters) {
+    s_selected_bucket = idx;
+    s_selected_name_index = ni;
+    if (idx < 0) {
         memcpy((void *)s_selected_code, "---", 3);
         s_selected_code[3] = '\0'; // Ensure null termination
         s_selected_name = "---";
-        s_selected_offset_hours = 0.0f;
-    } else {
-        int idx = best_candidates[(best_count == 1) ? 0 : (rand() % best_count)];
-        const TzInfo *tz = &TZ_LIST[idx];
-        bool is_dst = _airport_is_dst(tz, (int64_t)current_utc_t);
-        // reconstruct float offset from quarter-hour units
-        s_selected_offset_hours = (is_dst ? tz->dst_quarters : tz->std_quarters) * 0.25f;
-        int cnt = tz->name_count;
-        int ni  = (cnt == 1) ? 0 : (rand() % cnt);
-        // unpack 3-letter code from bit-packed 15-bit entries
-        uint16_t bits = airport_code_pool_bits[tz->name_offset + ni];
-        s_selected_code[0] = 'A' + ((bits >> 10) & 0x1F);
-        s_selected_code[1] = 'A' + ((bits >> 5) & 0x1F);
-        s_selected_code[2] = 'A' + ( bits        & 0x1F);
-        s_selected_code[3] = '\0';
-        s_selected_name = _airport_flat_name(NAME_POOL, tz->name_offset + ni);
+        s_selected_offset_quarters = 0;
+        return;
+    }
+    s_selected_offset_quarters = offset_quarters;
+    _airport_code(s_selected_code, idx, ni);
+    s_selected_name = _airport_name(_airport_name_first(idx) + ni);
+}
+
+// Apply a pick to world strip row `row`; only the code is shown there
+static inline void _airport_strip_select(int row, const AirportPick *pick) {
+    s_strip_bucket[row] = pick->bucket;
+    s_strip_offset_quarters[row] = pick->offset_quarters;
+    if (pick->bucket < 0) {
+        memcpy(s_strip_code[row], "---", 4);
+        return;
+    }
+    _airport_code(s_strip_code[row], pick->bucket, pick->name_index);
+}
+
+// Pick an airport for each of `count` targets in one batched pass over the
+// bucket order.  Target 0 uses the same hash streams the hero always used.
+static inline void _airport_pick_new(time_t current_utc_t, const long *targets, int count,
+                                     AirportPick *picks) {
+    if (!_airport_data_load()) {
+        for (int t = 0; t < count; ++t) picks[t] = (AirportPick){ -1, 0, 0 };
+        return;
+    }
+    _airport_offsets_advance(current_utc_t);
+    if (current_utc_t < s_order_valid_from || current_utc_t >= s_order_valid_until) {
+        _airport_order_build(current_utc_t);
+    }
+
+    // 1. Winner runs of every target
+    AirportRun runs[AIRPORT_TARGETS_MAX];
+    _airport_sweep(current_utc_t, targets, count, runs);
+
+    // 2. Per target, pick a candidate, then an airport code from that bucket,
+    //    both hashed from the evaluation instant
+    for (int t = 0; t < count; ++t) {
+        if (runs[t].count == 0) {
+            picks[t] = (AirportPick){ -1, 0, 0 };
+            continue;
+        }
+        uint32_t stream = (uint32_t)t * PICK_STREAMS_PER_TARGET;
+        int idx = s_order[runs[t].first +
+                          _airport_pick(current_utc_t, stream + PICK_STREAM_BUCKET, runs[t].count)];
+        int ni  = _airport_pick(current_utc_t, stream + PICK_STREAM_NAME, _airport_name_count(idx));
+        picks[t] = (AirportPick){ idx, ni, s_bucket_quarters[idx] };
+    }
+}
+
+// Phone schedule ----------------------------------------------------------
+// Without a checksum (data generated before schedules existed) every
+// schedule is rejected and the sweep always runs.
+#ifndef AIRPORT_DATA_CHECKSUM
+#define AIRPORT_DATA_CHECKSUM 0u
+#endif
+
+static AirportSchedule s_schedule;
+static bool            s_schedule_ok = false;
+
+// Hero pick for `current_utc_t` from the phone schedule.  Only the exact slot
+// instants are covered: an off-grid evaluation (first one after boot) hashes
+// its own instant, which the phone cannot know in advance.
+static inline bool _airport_schedule_pick(time_t current_utc_t, long target_seconds_of_day,
+                                          AirportPick *out) {
+    if (!s_schedule_ok || s_schedule.target_quarters != target_seconds_of_day / SLOT_SECONDS) return false;
+    time_t since = current_utc_t - (time_t)s_schedule.first_slot_utc;
+    if (since < 0 || since % SLOT_SECONDS != 0) return false;
+    long quarter = (long)(since / SLOT_SECONDS);
+    if (quarter % 4 == 3) return false;
+    long slot = (quarter / 4) * AIRPORT_SCHEDULE_SLOTS_PER_HOUR + quarter % 4;
+    if (slot >= s_schedule.slot_count || !_airport_data_load()) return false;
+
+    const AirportScheduleSlot *entry = &s_schedule.slots[slot];
+    if (entry->bucket == AIRPORT_SCHEDULE_NONE) {
+        *out = (AirportPick){ -1, 0, 0 };
+        return true;
     }
+    int idx = entry->bucket;
+    *out = (AirportPick){ idx, _airport_pick(current_utc_t, PICK_STREAM_NAME, _airport_name_count(idx)),
+                          entry->offset_quarters };
+    return true;
+}
+
+// Evaluate the hero target and every strip target at `current_utc_t`.  With
+// `with_hero` false the hero keeps its current (restored) pick.  A scheduled
+// hero with no strip rows needs no sweep at all.
+static inline void _airport_evaluate(time_t current_utc_t, long target_seconds_of_day, bool with_hero) {
+    long targets[AIRPORT_TARGETS_MAX];
+    AirportPick picks[AIRPORT_TARGETS_MAX];
+    targets[0] = target_seconds_of_day;
+    for (int r = 0; r < s_strip_count; ++r) targets[1 + r] = s_strip_target[r];
+
+    AirportPick hero;
+    bool scheduled = with_hero && _airport_schedule_pick(current_utc_t, target_seconds_of_day, &hero);
+    if (!scheduled || s_strip_count > 0) _airport_pick_new(current_utc_t, targets, 1 + s_strip_count, picks);
+    if (scheduled) picks[0] = hero;
+    if (with_hero) _airport_select(picks[0].bucket, picks[0].name_index, picks[0].offset_quarters);
+    for (int r = 0; r < s_strip_count; ++r) _airport_strip_select(r, &picks[1 + r]);
+    s_selected_target = target_seconds_of_day;
     s_last_re_eval_time = current_utc_t;
 }
 
 // Public function implementations -----------------------------------------
-static inline TextLayer* clock_closest_airport_noon_code_init(GRect bounds,
-                                                              Layer *window_layer) {
-    TextLayer* layer = text_layer_util_create(bounds, window_layer, "---", FONT_KEY_GOTHIC_28_BOLD);
+static inline FaceText* clock_closest_airport_noon_code_init(GRect bounds) {
+    FaceText* text = face_text_create(bounds, "---", FONT_KEY_GOTHIC_28_BOLD);
     memcpy((void *)s_selected_code, "---", 3);
     s_selected_code[3] = '\0'; // Ensure null termination
     s_selected_name = "---";
+    s_selected_bucket = -1;
     s_last_update_time = -1;
+    _airport_data_load();
     s_last_re_eval_time = -1;
-    return layer;
+    return text;
 }
 
-static inline TextLayer* clock_closest_airport_noon_time_init(GRect bounds,
-                                                              Layer *window_layer) {
-    TextLayer* layer = text_layer_util_create(bounds, window_layer, "--:--", FONT_KEY_LECO_42_NUMBERS);
-    s_selected_offset_hours = 0.0f;
-    return layer;
+static inline FaceText* clock_closest_airport_noon_time_init(GRect bounds) {
+    FaceText* text = face_text_create(bounds, "--:--", FONT_KEY_LECO_42_NUMBERS);
+    // Digits and colon are pre-rendered once and blitted per cell
+    face_text_cache_glyphs(text, "0123456789:");
+    memcpy(s_hero_time, "--:--", sizeof(s_hero_time));
+    s_selected_offset_quarters = 0;
+    return text;
 }
 
-static inline void clock_closest_airport_noon_deinit(TextLayer *layer) {
-    if (layer) {
-        text_layer_destroy(layer);
+static inline void clock_closest_airport_noon_deinit(FaceText *text) {
+    face_text_destroy(text);
+}
+
+static inline void clock_closest_airport_noon_set_strip(const long *targets_seconds_of_day,
+                                                        int         count) {
+    if (count < 0) count = 0;
+    if (count > AIRPORT_STRIP_MAX) count = AIRPORT_STRIP_MAX;
+    s_strip_count = count;
+    for (int r = 0; r < AIRPORT_STRIP_MAX; ++r) {
+        s_strip_target[r] = r < count ? targets_seconds_of_day[r] : 0;
+        s_strip_bucket[r] = -1;
+        s_strip_offset_quarters[r] = 0;
+        memcpy(s_strip_code[r], "---", 4);
+    }
+}
+
+// Re-picks the strip rows at the instant of the current hero pick, which is
+// left alone; before the first evaluation there is nothing to redo
+static inline void clock_closest_airport_noon_refresh_strip(void) {
+    if (s_strip_count > 0 && s_last_re_eval_time >= 0) {
+        _airport_evaluate(s_last_re_eval_time, s_selected_target, false);
     }
 }
 
-static inline void clock_closest_airport_noon_update(TextLayer *code_layer,
-                                                     TextLayer *time_layer,
-                                                     time_t     current_utc_t,
-                                                     long       target_seconds_of_day) {
-    if (!code_layer || !time_layer) return;
+static inline const char* clock_closest_airport_noon_strip_code(int row) {
+    return (row >= 0 && row < s_strip_count) ? s_strip_code[row] : "";
+}
+
+// Takes a schedule as received from the phone (or read back from persistent
+// storage); returns false, keeping none, if it does not match this build.
+static inline bool clock_closest_airport_noon_set_schedule(const uint8_t *data, size_t length) {
+    s_schedule_ok = false;
+    if (!data || length < AIRPORT_SCHEDULE_HEADER_BYTES || length > sizeof(s_schedule)) return false;
+    memcpy(&s_schedule, data, length);
+    if (s_schedule.version != AIRPORT_SCHEDULE_VERSION ||
+        s_schedule.data_checksum != AIRPORT_DATA_CHECKSUM || AIRPORT_DATA_CHECKSUM == 0u ||
+        s_schedule.bucket_count != TZ_LIST_COUNT ||
+        s_schedule.slot_count > AIRPORT_SCHEDULE_SLOTS_MAX ||
+        length != AIRPORT_SCHEDULE_HEADER_BYTES + s_schedule.slot_count * sizeof(AirportScheduleSlot) ||
+        s_schedule.first_slot_utc % 3600 != 0) return false;
+    for (int i = 0; i < s_schedule.slot_count; ++i) {
+        uint8_t bucket = s_schedule.slots[i].bucket;
+        if (bucket != AIRPORT_SCHEDULE_NONE && bucket >= TZ_LIST_COUNT) return false;
+    }
+    s_schedule_ok = true;
+    return true;
+}
+
+// First UTC second the schedule no longer covers for this target, or 0 if
+// there is no usable schedule.
+static inline time_t clock_closest_airport_noon_schedule_until(long target_seconds_of_day) {
+    if (!s_schedule_ok || s_schedule.target_quarters != target_seconds_of_day / SLOT_SECONDS) return 0;
+    int hours = (s_schedule.slot_count + AIRPORT_SCHEDULE_SLOTS_PER_HOUR - 1) / AIRPORT_SCHEDULE_SLOTS_PER_HOUR;
+    return (time_t)s_schedule.first_slot_utc + (time_t)hours * 3600;
+}
+
+// Fills in the request for a full schedule; false if this build's data
+// cannot be scheduled by the phone.
+static inline bool clock_closest_airport_noon_schedule_request(AirportScheduleRequest *out,
+                                                               long target_seconds_of_day) {
+    if (!out || AIRPORT_DATA_CHECKSUM == 0u) return false;
+    out->version         = AIRPORT_SCHEDULE_VERSION;
+    out->target_quarters = (uint8_t)(target_seconds_of_day / SLOT_SECONDS);
+    out->slot_count      = AIRPORT_SCHEDULE_SLOTS_MAX;
+    out->bucket_count    = (uint8_t)TZ_LIST_COUNT;
+    out->data_checksum   = AIRPORT_DATA_CHECKSUM;
+    return true;
+}
+
+static inline bool clock_closest_airport_noon_get_selection(AirportSelection *out) {
+    if (!out || s_selected_bucket < 0 || s_last_re_eval_time < 0) return false;
+    out->eval_time       = (int32_t)s_last_re_eval_time;
+    out->pick            = (SelectionRecord){ 0, (uint8_t)s_selected_bucket, (uint8_t)s_selected_name_index };
+    out->offset_quarters = (int8_t)s_selected_offset_quarters;
+    out->target_quarters = (uint8_t)(s_selected_target / SLOT_SECONDS);
+    return true;
+}
+
+// Re-applies a persisted pick if it is still the one the current evaluation
+// slot would show: it was made for the same target, at or after the most
+// recent :00/:15/:30 boundary, and not in the future.
+static inline bool clock_closest_airport_noon_restore_selection(const AirportSelection *sel,
+                                                                time_t current_utc_t,
+                                                                long   target_seconds_of_day) {
+    if (!sel) return false;
+    time_t slot_start = current_utc_t - (current_utc_t % SLOT_SECONDS);
+    if ((slot_start % 3600) / SLOT_SECONDS == 3) slot_start -= SLOT_SECONDS; // :45 belongs to :30
+    if (sel->eval_time < slot_start || sel->eval_time > current_utc_t) return false;
+    if (sel->target_quarters != target_seconds_of_day / SLOT_SECONDS) return false;
+    if (sel->pick.bucket >= TZ_LIST_COUNT || sel->pick.name_index >= _airport_name_count(sel->pick.bucket)) return false;
+
+    _airport_select(sel->pick.bucket, sel->pick.name_index, sel->offset_quarters);
+    s_selected_target = target_seconds_of_day;
+    s_last_re_eval_time = sel->eval_time;
+    // Strip rows are a function of the same instant, so one pass recovers them
+    if (s_strip_count > 0) _airport_evaluate(sel->eval_time, target_seconds_of_day, false);
+    return true;
+}
+
+static inline void clock_closest_airport_noon_update(FaceText *code_text,
+                                                     FaceText *time_text,
+                                                     const UtcTime *now,
+                                                     long      target_seconds_of_day) {
+    if (!code_text || !time_text || !now) return;
+    time_t current_utc_t = now->utc;
 
     // Skip redundant updates in the same second
     if (current_utc_t == s_last_update_time) return;
     s_last_update_time = current_utc_t;
 
     // Re-evaluate every 15-minutes on UTC :00, :15, :30 (excluding :45)
-    struct tm *utc_tm = gmtime(&current_utc_t);
     bool needs_eval = false;
-    if (utc_tm && (utc_tm->tm_min % 15 == 0) && (utc_tm->tm_min != 45) && utc_tm->tm_sec == 0) {
+    if ((now->min % 15 == 0) && (now->min != 45) && now->sec == 0) {
         if (current_utc_t != s_last_re_eval_time) {
             needs_eval = true;
         }
@@ -189,20 +768,41 @@ static inline void clock_closest_airport_noon_update(TextLayer *code_layer,
     }
 
     if (needs_eval) {
-        _airport_pick_new(current_utc_t, target_seconds_of_day);
+        _airport_evaluate(current_utc_t, target_seconds_of_day, true);
     }
 
-    // Update text layers ---------------------------------------------------
-    text_layer_set_text(code_layer, s_selected_code);
-    long offset_seconds = (long)(s_selected_offset_hours * 3600.0f);
-    // Compute local time using utc_tm and offset to avoid second gmtime()
-    long total_local_secs = (utc_tm->tm_hour * 3600L + utc_tm->tm_min * 60L + utc_tm->tm_sec + offset_seconds) % DAY_SECONDS;
-    if (total_local_secs < 0) total_local_secs += DAY_SECONDS;
+    // Update fields (unchanged text does not redraw) ------------------------
+    face_text_set_text(code_text, s_selected_code);
+    int32_t total_local_secs = time_math_local_sod(now->sod, s_selected_offset_quarters);
     int local_min = (int)((total_local_secs / 60) % 60);
     int local_sec = (int)(total_local_secs % 60);
-    static char s_timebuf[10];
-    snprintf(s_timebuf, sizeof(s_timebuf), "%02d:%02d", local_min, local_sec);
-    text_layer_set_text(time_layer, s_timebuf);
+    // Usually only the last digit moves: hand over just the changed cells
+    const char next[5] = {
+        (char)('0' + local_min / 10), (char)('0' + local_min % 10), ':',
+        (char)('0' + local_sec / 10), (char)('0' + local_sec % 10)
+    };
+    int len = s_hero_seconds ? 5 : 2;
+    int from = 0;
+    while (from < len && next[from] == s_hero_time[from]) from++;
+    if (from < len) {
+        memcpy(s_hero_time + from, next + from, (size_t)(len - from));
+        s_hero_time[len] = '\0';
+        face_text_set_tail(time_text, s_hero_time, from);
+    }
+}
+
+static inline time_t clock_closest_airport_noon_next_change(const UtcTime *now) {
+    // The hero shows seconds (or minutes); code and name only change on the
+    // :00/:15/:30 slots, which always fall on one of those seconds
+    return s_hero_seconds ? now->utc + 1 : now->utc - now->sec + 60;
+}
+
+// Takes effect on the next update, which redraws the whole hero time
+static inline void clock_closest_airport_noon_set_seconds(bool show_seconds) {
+    if (show_seconds == s_hero_seconds) return;
+    s_hero_seconds = show_seconds;
+    memcpy(s_hero_time, "--:--", sizeof(s_hero_time));
+    s_last_update_time = -1;
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,63 @@
+#ifndef CLOCK_MODULE_H
+#define CLOCK_MODULE_H
+
+// Interface between the face and its clock modules.  watchface.c keeps the
+// modules that are compiled in as a static table of ClockModules and drives
+// them from the wakeup scheduler: each one is rendered only once the second
+// it reported from next_change() has come, and is handed only the time
+// fields it declared.
+//
+// CLOCK_WITH_TID / CLOCK_WITH_BEAT select the optional footer modules.
+// wscript sets them from its CLOCK_MODULES list and leaves the sources of
+// the modules that are off out of the link; the airport module is the face
+// itself and always built.
+
+#include <pebble.h>
+#include <stdint.h>
+#include "time_math.h"
+
+#ifndef CLOCK_WITH_TID
+#define CLOCK_WITH_TID 1
+#endif
+
+#ifndef CLOCK_WITH_BEAT
+#define CLOCK_WITH_BEAT 1
+#endif
+
+// Time fields a module reads; epoch seconds are always passed
+typedef enum {
+    CLOCK_TIME_MILLIS = 1 << 0, // milliseconds within the second
+    CLOCK_TIME_UTC    = 1 << 1  // UtcTime breakdown (second of day, h:m:s)
+} ClockTimeFields;
+
+// What the scheduler hands a module; fields it did not ask for are 0/NULL
+typedef struct {
+    time_t         seconds;      // UTC epoch seconds of the wakeup
+    uint16_t       milliseconds; // CLOCK_TIME_MILLIS
+    const UtcTime *utc;          // CLOCK_TIME_UTC
+} ClockTime;
+
+// How the battery tiers treat a module
+typedef enum {
+    CLOCK_ECONOMY_MINUTES = 1 << 0, // economy holds it to minute boundaries
+    CLOCK_CRITICAL_SHOWN  = 1 << 1, // still rendered in the critical tier
+    CLOCK_GLANCE_SHOWN    = 1 << 2  // still rendered, on minutes, while glance mode rests
+} ClockTierFlags;
+
+typedef struct {
+    const char *name;
+    uint8_t     fields;     // ClockTimeFields
+    uint8_t     tiers;      // ClockTierFlags
+    // Creates the module's fields; `bounds` is the whole face
+    void   (*init)(GRect bounds);
+    void   (*deinit)(void);
+    // Brings the fields up to `now`; only changed text is redrawn
+    void   (*render)(const ClockTime *now);
+    // UTC second of the next visible change after `now`
+    time_t (*next_change)(const ClockTime *now);
+    // Blanks what the critical tier hides, or all of the module while glance
+    // mode rests if it is not CLOCK_GLANCE_SHOWN (may be NULL)
+    void   (*hide)(void);
+} ClockModule;
+
+#endif // CLOCK_MODULE_H
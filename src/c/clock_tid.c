@@ -1,12 +1,31 @@
 #include "clock_tid.h"
 #include <pebble.h>
 #include <stdint.h> // For uint types
-#include "text_layer_util.h"
-#include <stdlib.h> // For rand()
+#include "time_math.h"
+
+#define TID_TS_DIGITS  11 // base-32 timestamp digits
+#define TID_CID_DIGITS 2  // base-32 clock ID digits
+#define TID_LEN        (TID_TS_DIGITS + TID_CID_DIGITS)
 
 static const char S32_CHAR[] = "234567abcdefghijklmnopqrstuvwxyz";
 static uint64_t last_timestamp;
 static char s_tid_buffer[14];
+// Base-32 digits of last_timestamp as shown in s_tid_buffer, most
+// significant first; valid once s_encoded is set
+static uint8_t s_digits[TID_TS_DIGITS];
+static bool s_encoded;
+// xorshift32 state for the random clock ID; private to this module, never 0
+static uint32_t s_cid_state = 0x2545f491u;
+
+// Next clock ID (0-1023) from the top bits of a xorshift32 step
+static uint16_t next_clock_id(void) {
+    uint32_t x = s_cid_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    s_cid_state = x;
+    return (uint16_t)(x >> 22);
+}
 
 // Helper to encode a value into a fixed-width base-32 string, right-to-left, padded with S32_CHAR[0]
 static void encode_to_base32_fixed_width(char *out_buf, size_t width, uint64_t val) {
@@ -20,44 +39,110 @@ static void encode_to_base32_fixed_width(char *out_buf, size_t width, uint64_t v
     }
 }
 
-// Generate monotonic TID string into tid_buffer
-static void clock_tid_get_string(char *tid_buffer, size_t tid_buffer_len, time_t seconds, uint16_t milliseconds) {
-    if (tid_buffer_len < sizeof(s_tid_buffer)) return;
+// Full encode of the timestamp digits; used on the first tick and for jumps
+// that do not fit the 32-bit delta path
+static void encode_timestamp_full(char *out_buf, uint64_t val) {
+    for (int i = TID_TS_DIGITS - 1; i >= 0; --i) {
+        s_digits[i] = (uint8_t)(val & 31);
+        out_buf[i] = S32_CHAR[s_digits[i]];
+        val >>= 5;
+    }
+    s_encoded = true;
+}
+
+// Adds `delta` to the stored digits with carry propagation, rewriting only
+// the tail that is touched. Returns the first column whose digit changed
+// (TID_TS_DIGITS if none). Overflow past the top digit wraps, exactly like
+// the fixed-width full encode truncates.
+static int encode_timestamp_delta(char *out_buf, uint32_t delta) {
+    int first_changed = TID_TS_DIGITS;
+    uint32_t addend = delta;
+    for (int i = TID_TS_DIGITS - 1; i >= 0 && addend; --i) {
+        uint32_t sum = s_digits[i] + (addend & 31);
+        addend >>= 5;
+        if (sum >= 32) {
+            sum -= 32;
+            addend += 1;
+        }
+        if (sum != s_digits[i]) {
+            s_digits[i] = (uint8_t)sum;
+            out_buf[i] = S32_CHAR[sum];
+            first_changed = i;
+        }
+    }
+    return first_changed;
+}
 
-    uint64_t current_micros = (uint64_t)seconds * 1000000 + (uint64_t)milliseconds * 1000;
+// Generate monotonic TID string into tid_buffer. Returns the first column
+// that differs from the previous string (TID_LEN if it is unchanged).
+static int clock_tid_get_string(char *tid_buffer, size_t tid_buffer_len, time_t seconds, uint16_t milliseconds) {
+    if (tid_buffer_len < sizeof(s_tid_buffer)) return TID_LEN;
+
+    uint64_t current_micros = time_math_micros(seconds, milliseconds);
     if (current_micros <= last_timestamp) {
         current_micros = last_timestamp + 1;
     }
+    uint64_t delta = current_micros - last_timestamp;
     last_timestamp = current_micros;
 
-    // Encode 11-char base-32 timestamp
-    encode_to_base32_fixed_width(tid_buffer, 11, current_micros);
+    // Encode 11-char base-32 timestamp, incrementally when possible
+    int first_changed;
+    if (s_encoded && (delta >> 32) == 0) {
+        first_changed = encode_timestamp_delta(tid_buffer, (uint32_t)delta);
+    } else {
+        encode_timestamp_full(tid_buffer, current_micros);
+        first_changed = 0;
+    }
 
     // Encode 2-char random clock ID (0-1023)
-    uint16_t cid = (uint16_t)(rand() % 1024);
-    encode_to_base32_fixed_width(tid_buffer + 11, 2, cid);
+    uint16_t cid = next_clock_id();
+    char cid_chars[TID_CID_DIGITS];
+    encode_to_base32_fixed_width(cid_chars, TID_CID_DIGITS, cid);
+    for (int i = 0; i < TID_CID_DIGITS; ++i) {
+        if (tid_buffer[TID_TS_DIGITS + i] != cid_chars[i]) {
+            tid_buffer[TID_TS_DIGITS + i] = cid_chars[i];
+            if (first_changed > TID_TS_DIGITS + i) first_changed = TID_TS_DIGITS + i;
+        }
+    }
 
-    tid_buffer[13] = '\0';
+    tid_buffer[TID_LEN] = '\0';
+    return first_changed;
 }
 
 // --- Pebble UI Interface Functions ---
 
-TextLayer* clock_tid_init(GRect bounds, Layer *window_layer) {
-    return text_layer_util_create(bounds, window_layer, "-----", FONT_KEY_GOTHIC_18_BOLD);
+FaceText* clock_tid_init(GRect bounds) {
+    s_encoded = false; // the new field shows the placeholder, start over
+    // Seed the clock ID generator from the launch time
+    time_t seconds;
+    uint16_t milliseconds;
+    time_ms(&seconds, &milliseconds);
+    uint32_t seed = (uint32_t)seconds * 1000u + milliseconds;
+    if (seed) s_cid_state = seed;
+    return face_text_create(bounds, "-----", FONT_KEY_GOTHIC_18_BOLD);
 }
 
-void clock_tid_deinit(TextLayer *layer) {
-    if (layer) {
-        text_layer_destroy(layer);
-    }
+void clock_tid_deinit(FaceText *text) {
+    face_text_destroy(text);
 }
 
-void clock_tid_update(TextLayer *layer, time_t current_seconds_utc, uint16_t current_milliseconds) {
-    if (!layer) return;
+int clock_tid_update(FaceText *text, time_t current_seconds_utc, uint16_t current_milliseconds) {
+    if (!text) return TID_LEN;
 
-    // Generate the full TID string into the static buffer
-    clock_tid_get_string(s_tid_buffer, sizeof(s_tid_buffer), current_seconds_utc, current_milliseconds);
+    // Advance the TID string in the static buffer, touching only the tail
+    int first_changed = clock_tid_get_string(s_tid_buffer, sizeof(s_tid_buffer),
+                                             current_seconds_utc, current_milliseconds);
+
+    // Update the field; the unchanged head is neither compared nor copied
+    face_text_set_tail(text, s_tid_buffer, first_changed);
+    return first_changed;
+}
+
+void clock_tid_hide(FaceText *text) {
+    face_text_set_text(text, "");
+    s_encoded = false; // the tail path would leave the head blank
+}
 
-    // Update the TextLayer
-    text_layer_set_text(layer, s_tid_buffer);
+time_t clock_tid_next_change(time_t now) {
+    return now + 1;
 }
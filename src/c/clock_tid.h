@@ -4,14 +4,24 @@
 #include <pebble.h>
 #include <stddef.h> // For size_t
 #include <stdint.h> // For uint16_t
+#include "face_layer.h"
+#include "time_math.h"
 
-// Initializes the TID clock layer
-TextLayer* clock_tid_init(GRect bounds, Layer *window_layer);
+// Initializes the TID clock field
+FaceText* clock_tid_init(GRect bounds);
 
-// Deinitializes the TID clock layer
-void clock_tid_deinit(TextLayer *layer);
+// Deinitializes the TID clock field
+void clock_tid_deinit(FaceText *text);
 
-// Updates the TID clock layer
-void clock_tid_update(TextLayer *layer, time_t current_seconds_utc, uint16_t current_milliseconds);
+// Updates the TID clock field. Returns the first of the 13 columns that
+// changed since the previous update (13 if none did).
+int clock_tid_update(FaceText *text, time_t current_seconds_utc, uint16_t current_milliseconds);
+
+// Blanks the TID clock field; the next update writes the whole string
+void clock_tid_hide(FaceText *text);
+
+// UTC second at which the field should next be refreshed. The timestamp
+// moves continuously; it is shown at one update per second.
+time_t clock_tid_next_change(time_t now);
 
 #endif // CLOCK_TID_H
@@ -0,0 +1,306 @@
+#include "face_layer.h"
+#include <pebble.h>
+#include <string.h>
+#include "profiler.h"
+
+#define FACE_TEXT_MAX 8 // Maximum number of fields on the face
+
+struct FaceText {
+    GRect          bounds;
+    GFont          font;
+    GTextAlignment alignment;
+    bool           in_use;
+    int8_t         profile_field; // ProfileField, -1 = not counted
+    char           text[FACE_TEXT_MAX_LEN];
+};
+
+static Layer   *s_face_layer;
+static FaceText s_texts[FACE_TEXT_MAX];
+static GColor   s_text_color;
+static bool     s_frame_pending; // a frame was asked for and has not been drawn yet
+
+// Glyph cache: every glyph of one field, side by side in a single 1-bit strip
+// (aplite: plain 1-bit, drawn with Set/Clear; others: 1-bit palette with a
+// transparent background).  Built inside the update proc, which is the only
+// place the frame buffer can be read.
+typedef struct {
+    FaceText *field;               // field drawn from the cache, or NULL
+    char      glyphs[FACE_GLYPH_MAX + 1];
+    bool      ready;               // strip rendered for the field's font
+    int16_t   width[FACE_GLYPH_MAX];
+    GBitmap  *strip;
+    GBitmap  *cells[FACE_GLYPH_MAX];
+} FaceGlyphCache;
+
+static FaceGlyphCache s_glyph_cache;
+#ifndef PBL_PLATFORM_APLITE
+static GColor s_glyph_palette[2];
+#endif
+
+// --- Static helper functions ---
+
+static void face_glyphs_release(void) {
+    for (int i = 0; i < FACE_GLYPH_MAX; ++i) {
+        if (s_glyph_cache.cells[i]) gbitmap_destroy(s_glyph_cache.cells[i]);
+        s_glyph_cache.cells[i] = NULL;
+    }
+    if (s_glyph_cache.strip) gbitmap_destroy(s_glyph_cache.strip);
+    s_glyph_cache.strip = NULL;
+    s_glyph_cache.ready = false;
+}
+
+// True if pixel (x, y) of the frame buffer has the text colour
+static bool face_fb_is_text(GBitmap *fb, int x, int y) {
+    GBitmapDataRowInfo row = gbitmap_get_data_row_info(fb, (uint16_t)y);
+    if (x < row.min_x || x > row.max_x) return false;
+    if (gbitmap_get_format(fb) == GBitmapFormat1Bit) {
+        bool white = (row.data[x >> 3] >> (x & 7)) & 1;
+        return white == gcolor_equal(s_text_color, GColorWhite);
+    }
+    return row.data[x] == s_text_color.argb;
+}
+
+// Renders every glyph at the field's origin and copies it into the strip.
+// The field is cleared to the background before each glyph and once more at
+// the end; like both colour schemes, the background is taken to be the
+// opposite of the text colour.
+static bool face_glyphs_build(GContext *ctx, FaceText *t) {
+    FaceGlyphCache *g = &s_glyph_cache;
+    int count = (int)strlen(g->glyphs);
+    GRect box = GRect(0, 0, t->bounds.size.w, t->bounds.size.h);
+    int16_t digit_w = 0, total_w = 0;
+    for (int i = 0; i < count; ++i) {
+        char str[2] = { g->glyphs[i], '\0' };
+        g->width[i] = graphics_text_layout_get_content_size(str, t->font, box,
+                                                            GTextOverflowModeFill, GTextAlignmentLeft).w;
+        if (g->glyphs[i] >= '0' && g->glyphs[i] <= '9' && g->width[i] > digit_w) digit_w = g->width[i];
+    }
+    for (int i = 0; i < count; ++i) {
+        if (g->glyphs[i] >= '0' && g->glyphs[i] <= '9') g->width[i] = digit_w;
+        total_w += g->width[i];
+    }
+    if (total_w <= 0) return false;
+
+    GSize size = GSize(total_w, t->bounds.size.h);
+#ifdef PBL_PLATFORM_APLITE
+    g->strip = gbitmap_create_blank(size, GBitmapFormat1Bit);
+#else
+    g->strip = gbitmap_create_blank_with_palette(size, GBitmapFormat1BitPalette, s_glyph_palette, false);
+#endif
+    if (!g->strip) return false;
+    uint8_t *bits = gbitmap_get_data(g->strip);
+    uint16_t stride = gbitmap_get_bytes_per_row(g->strip);
+    memset(bits, 0, (size_t)stride * size.h);
+
+    GColor clear = gcolor_equal(s_text_color, GColorBlack) ? GColorWhite : GColorBlack;
+    int16_t at = 0;
+    for (int i = 0; i < count; ++i) {
+        char str[2] = { g->glyphs[i], '\0' };
+        GRect cell = GRect(t->bounds.origin.x, t->bounds.origin.y, g->width[i], t->bounds.size.h);
+        graphics_context_set_fill_color(ctx, clear);
+        graphics_fill_rect(ctx, t->bounds, 0, GCornerNone);
+        graphics_draw_text(ctx, str, t->font, cell, GTextOverflowModeFill, GTextAlignmentCenter, NULL);
+
+        GBitmap *fb = graphics_capture_frame_buffer(ctx);
+        if (!fb) return false;
+        for (int y = 0; y < cell.size.h; ++y) {
+            for (int x = 0; x < cell.size.w; ++x) {
+                if (!face_fb_is_text(fb, cell.origin.x + x, cell.origin.y + y)) continue;
+                int sx = at + x;
+#ifdef PBL_PLATFORM_APLITE
+                bits[y * stride + (sx >> 3)] |= (uint8_t)(1 << (sx & 7));          // LSB first
+#else
+                bits[y * stride + (sx >> 3)] |= (uint8_t)(0x80 >> (sx & 7));       // MSB first
+#endif
+            }
+        }
+        graphics_release_frame_buffer(ctx, fb);
+
+        g->cells[i] = gbitmap_create_as_sub_bitmap(g->strip, GRect(at, 0, g->width[i], t->bounds.size.h));
+        if (!g->cells[i]) return false;
+        at += g->width[i];
+    }
+    graphics_fill_rect(ctx, t->bounds, 0, GCornerNone);
+    return true;
+}
+
+// Blits the field's text cell by cell; false if a character is not cached
+static bool face_glyphs_draw(GContext *ctx, FaceText *t) {
+    FaceGlyphCache *g = &s_glyph_cache;
+    uint8_t index[FACE_TEXT_MAX_LEN];
+    int16_t total_w = 0;
+    int len = 0;
+    for (const char *c = t->text; *c; ++c, ++len) {
+        const char *hit = strchr(g->glyphs, *c);
+        if (!hit) return false;
+        index[len] = (uint8_t)(hit - g->glyphs);
+        total_w += g->width[index[len]];
+    }
+
+    int16_t x = t->bounds.origin.x;
+    if (t->alignment == GTextAlignmentCenter) x += (t->bounds.size.w - total_w) / 2;
+    else if (t->alignment == GTextAlignmentRight) x += t->bounds.size.w - total_w;
+#ifdef PBL_PLATFORM_APLITE
+    graphics_context_set_compositing_mode(ctx, gcolor_equal(s_text_color, GColorWhite) ? GCompOpSet : GCompOpClear);
+#else
+    s_glyph_palette[0] = GColorClear;
+    s_glyph_palette[1] = s_text_color;
+    graphics_context_set_compositing_mode(ctx, GCompOpSet);
+#endif
+    for (int i = 0; i < len; ++i) {
+        GBitmap *cell = g->cells[index[i]];
+        graphics_draw_bitmap_in_rect(ctx, cell, GRect(x, t->bounds.origin.y, g->width[index[i]], t->bounds.size.h));
+        x += g->width[index[i]];
+    }
+    graphics_context_set_compositing_mode(ctx, GCompOpAssign);
+    return true;
+}
+
+static void face_layer_update_proc(Layer *layer, GContext *ctx) {
+    (void)layer;
+    PROFILE_FRAME();
+    s_frame_pending = false;
+    // The firmware composites the whole window for any dirty layer, so every
+    // field is drawn; a frame is only asked for when some field's text changed.
+    graphics_context_set_text_color(ctx, s_text_color);
+    for (int i = 0; i < FACE_TEXT_MAX; ++i) {
+        FaceText *t = &s_texts[i];
+        if (!t->in_use) continue;
+        if (t == s_glyph_cache.field) {
+            if (!s_glyph_cache.ready) {
+                s_glyph_cache.ready = face_glyphs_build(ctx, t);
+                if (!s_glyph_cache.ready) { // out of memory: plain text from now on
+                    face_glyphs_release();
+                    s_glyph_cache.field = NULL;
+                }
+            }
+            if (s_glyph_cache.ready && face_glyphs_draw(ctx, t)) continue;
+        }
+        graphics_draw_text(ctx, t->text, t->font, t->bounds,
+                           GTextOverflowModeWordWrap, t->alignment, NULL);
+    }
+}
+
+static void face_text_invalidate(FaceText *text) {
+    PROFILE_FIELD_DIRTY(text->profile_field);
+    if (s_face_layer) {
+        layer_mark_dirty(s_face_layer);
+        s_frame_pending = true;
+    }
+}
+
+// Compares and copies `str` into the field from column `from` on
+static bool face_text_set_text_from(FaceText *text, const char *str, size_t from) {
+    size_t n = FACE_TEXT_MAX_LEN - 1 - from;
+    if (strncmp(text->text + from, str + from, n) == 0) {
+        return false; // No change, don't request a frame
+    }
+    strncpy(text->text + from, str + from, n);
+    text->text[FACE_TEXT_MAX_LEN - 1] = '\0';
+    face_text_invalidate(text);
+    return true;
+}
+
+// --- Public functions ---
+
+Layer* face_layer_create(GRect frame, Layer *parent) {
+    s_face_layer = layer_create(frame);
+    s_text_color = GColorBlack;
+    layer_set_update_proc(s_face_layer, face_layer_update_proc);
+    layer_add_child(parent, s_face_layer);
+    return s_face_layer;
+}
+
+void face_layer_destroy(void) {
+    if (s_face_layer) {
+        layer_destroy(s_face_layer);
+        s_face_layer = NULL;
+    }
+    s_frame_pending = false;
+    face_glyphs_release();
+    memset(&s_glyph_cache, 0, sizeof(s_glyph_cache));
+    memset(s_texts, 0, sizeof(s_texts));
+}
+
+bool face_layer_frame_pending(void) {
+    return s_frame_pending;
+}
+
+void face_layer_set_text_color(GColor color) {
+    s_text_color = color;
+    for (int i = 0; i < FACE_TEXT_MAX; ++i) {
+        if (s_texts[i].in_use) face_text_invalidate(&s_texts[i]);
+    }
+}
+
+FaceText* face_text_create(GRect bounds, const char *init_text, const char *font_key) {
+    for (int i = 0; i < FACE_TEXT_MAX; ++i) {
+        FaceText *t = &s_texts[i];
+        if (t->in_use) continue;
+        t->in_use = true;
+        t->bounds = bounds;
+        t->font = fonts_get_system_font(font_key);
+        t->alignment = GTextAlignmentCenter;
+        t->profile_field = -1;
+        t->text[0] = '\0';
+        face_text_set_text(t, init_text);
+        face_text_invalidate(t);
+        return t;
+    }
+    return NULL;
+}
+
+void face_text_destroy(FaceText *text) {
+    if (text) {
+        if (text == s_glyph_cache.field) {
+            face_glyphs_release();
+            s_glyph_cache.field = NULL;
+        }
+        text->in_use = false;
+        if (s_face_layer) layer_mark_dirty(s_face_layer);
+    }
+}
+
+bool face_text_set_text(FaceText *text, const char *str) {
+    if (!text || !str) return false;
+    return face_text_set_text_from(text, str, 0);
+}
+
+bool face_text_set_tail(FaceText *text, const char *str, int from) {
+    if (!text || !str) return false;
+    if (from <= 0) return face_text_set_text(text, str);
+    if (from >= FACE_TEXT_MAX_LEN - 1) return false;
+    return face_text_set_text_from(text, str, (size_t)from);
+}
+
+const char* face_text_get_text(const FaceText *text) {
+    return text ? text->text : "";
+}
+
+void face_text_set_profile_field(FaceText *text, int field) {
+    if (text) text->profile_field = (int8_t)field;
+}
+
+void face_text_set_font(FaceText *text, const char *font_key) {
+    if (!text) return;
+    text->font = fonts_get_system_font(font_key);
+    if (text == s_glyph_cache.field) face_glyphs_release(); // re-render in the new font
+    face_text_invalidate(text);
+}
+
+void face_text_set_alignment(FaceText *text, GTextAlignment alignment) {
+    if (!text) return;
+    text->alignment = alignment;
+    face_text_invalidate(text);
+}
+
+bool face_text_cache_glyphs(FaceText *text, const char *glyphs) {
+    if (!text || !glyphs || strlen(glyphs) > FACE_GLYPH_MAX) return false;
+    if (s_glyph_cache.field && s_glyph_cache.field != text) return false;
+    face_glyphs_release();
+    s_glyph_cache.field = text;
+    strncpy(s_glyph_cache.glyphs, glyphs, FACE_GLYPH_MAX);
+    s_glyph_cache.glyphs[FACE_GLYPH_MAX] = '\0';
+    face_text_invalidate(text);
+    return true;
+}
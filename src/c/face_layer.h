@@ -0,0 +1,72 @@
+#ifndef FACE_LAYER_H
+#define FACE_LAYER_H
+
+#include <pebble.h>
+#include <stdbool.h>
+
+// A single custom Layer that draws every text field of the face from one
+// update_proc, replacing one TextLayer per field.  Fields own a copy of their
+// text, so setting an unchanged string is a cheap compare and does not ask
+// the compositor for a new frame.  Bounds and fonts are resolved once when a
+// field is created.
+
+// Longest string a field can hold, including the terminating NUL
+#define FACE_TEXT_MAX_LEN 64
+
+typedef struct FaceText FaceText;
+
+// Creates the face layer covering `frame` and adds it to `parent`
+Layer* face_layer_create(GRect frame, Layer *parent);
+
+// Destroys the face layer and releases every field
+void face_layer_destroy(void);
+
+// True from a field change until the frame showing it has been drawn;
+// callers updating faster than the compositor can skip their next change
+bool face_layer_frame_pending(void);
+
+// Sets the text colour of every field (forces a full redraw)
+void face_layer_set_text_color(GColor color);
+
+// Adds a field drawn inside `bounds` with the given system font
+//   bounds: frame of the field, relative to the face layer
+//   init_text: initial text to display
+//   font_key: key of the system font, e.g. FONT_KEY_GOTHIC_24_BOLD
+FaceText* face_text_create(GRect bounds, const char *init_text, const char *font_key);
+
+// Releases a field
+void face_text_destroy(FaceText *text);
+
+// Updates the text of a field; only marks the face dirty if it changed.
+// Returns true if the field was invalidated.
+bool face_text_set_text(FaceText *text, const char *str);
+
+// Like face_text_set_text(), for callers that know the first `from`
+// characters are unchanged: only the tail is compared and copied.
+bool face_text_set_tail(FaceText *text, const char *str, int from);
+
+// Current text of a field ("" for NULL)
+const char* face_text_get_text(const FaceText *text);
+
+// Index the profiler counts the field's redraws under (a ProfileField in
+// profiler.h); fields without one are not counted
+void face_text_set_profile_field(FaceText *text, int field);
+
+// Changes the font of a field
+void face_text_set_font(FaceText *text, const char *font_key);
+
+// Changes the alignment of a field (fields are centered by default)
+void face_text_set_alignment(FaceText *text, GTextAlignment alignment);
+
+// Draws a field from pre-rendered glyphs instead of laying its text out
+// every frame.  Each character of `glyphs` (at most FACE_GLYPH_MAX) is
+// rendered once in the field's font on the next frame, copied out of the
+// frame buffer into one 1-bit strip, and blitted per character cell from then
+// on; text with other characters falls back to graphics_draw_text().  All
+// digits get the width of the widest one, so a centered time does not shift
+// as it counts.  A colour change only swaps the blit colour.  Only one field
+// can hold the cache; returns false if another field already does.
+#define FACE_GLYPH_MAX 12
+bool face_text_cache_glyphs(FaceText *text, const char *glyphs);
+
+#endif // FACE_LAYER_H
@@ -0,0 +1,109 @@
+#include "profiler.h"
+
+#if ENABLE_PROFILER
+
+#include <string.h>
+
+static ProfileSummary s_summary;
+static time_t   s_window_start;
+static uint32_t s_tick_start_ms;
+static uint32_t s_reeval_start_ms;
+static uint16_t s_message_heap;      // carried over from window to window
+static uint16_t s_message_reclaimed;
+
+// --- Static helper functions ---
+
+// Milliseconds on a free-running 32-bit clock; only differences matter
+static uint32_t profiler_now_ms(void) {
+    time_t seconds;
+    uint16_t milliseconds;
+    time_ms(&seconds, &milliseconds);
+    return (uint32_t)seconds * 1000u + milliseconds;
+}
+
+static uint16_t clamp_u16(uint32_t value) {
+    return value > UINT16_MAX ? UINT16_MAX : (uint16_t)value;
+}
+
+static void profiler_reset(time_t now) {
+    memset(&s_summary, 0, sizeof(s_summary));
+    s_summary.version = PROFILE_SUMMARY_VERSION;
+    s_summary.field_count = PROFILER_FIELDS;
+    uint32_t heap = (uint32_t)heap_bytes_free();
+    s_summary.heap_free_min = heap;
+    s_summary.heap_free_max = heap;
+    s_summary.heap_used_max = (uint32_t)heap_bytes_used();
+    s_summary.message_heap = s_message_heap;
+    s_summary.message_reclaimed = s_message_reclaimed;
+    s_window_start = now;
+}
+
+// Sends the current window; on failure (phone away, outbox busy) the window
+// keeps accumulating and is retried on the next tick.
+static void profiler_send(time_t now) {
+    DictionaryIterator *iter;
+    if (app_message_outbox_begin(&iter) != APP_MSG_OK) return;
+    s_summary.window_minutes = clamp_u16((uint32_t)(now - s_window_start) / 60);
+    dict_write_data(iter, MESSAGE_KEY_profile, (const uint8_t *)&s_summary, sizeof(s_summary));
+    if (app_message_outbox_send() != APP_MSG_OK) return;
+    profiler_reset(now);
+}
+
+// --- Public functions ---
+
+void profiler_init(void) {
+    profiler_reset(time(NULL));
+}
+
+uint32_t profiler_outbox_size(void) {
+    return dict_calc_buffer_size(1, sizeof(ProfileSummary));
+}
+
+void profiler_tick_begin(void) {
+    s_tick_start_ms = profiler_now_ms();
+}
+
+void profiler_tick_end(void) {
+    uint32_t elapsed = profiler_now_ms() - s_tick_start_ms;
+    s_summary.ticks++;
+    s_summary.tick_total_ms += elapsed;
+    if (elapsed > s_summary.tick_max_ms) s_summary.tick_max_ms = clamp_u16(elapsed);
+
+    uint32_t heap = (uint32_t)heap_bytes_free();
+    if (heap < s_summary.heap_free_min) s_summary.heap_free_min = heap;
+    if (heap > s_summary.heap_free_max) s_summary.heap_free_max = heap;
+    uint32_t used = (uint32_t)heap_bytes_used();
+    if (used > s_summary.heap_used_max) s_summary.heap_used_max = used;
+
+    time_t now = time(NULL);
+    if (now - s_window_start >= PROFILER_REPORT_MINUTES * 60) profiler_send(now);
+}
+
+void profiler_reeval_begin(void) {
+    s_reeval_start_ms = profiler_now_ms();
+}
+
+void profiler_reeval_end(bool re_evaluated) {
+    if (!re_evaluated) return;
+    uint32_t elapsed = profiler_now_ms() - s_reeval_start_ms;
+    if (s_summary.reeval_count < UINT16_MAX) s_summary.reeval_count++;
+    if (elapsed > s_summary.reeval_max_ms) s_summary.reeval_max_ms = clamp_u16(elapsed);
+}
+
+void profiler_field_dirty(int field) {
+    if (field < 0 || field >= PROFILER_FIELDS) return;
+    if (s_summary.redraws[field] < UINT16_MAX) s_summary.redraws[field]++;
+}
+
+void profiler_frame(void) {
+    if (s_summary.frames < UINT16_MAX) s_summary.frames++;
+}
+
+void profiler_message_heap(uint32_t held, uint32_t reclaimed) {
+    s_message_heap = clamp_u16(held);
+    s_message_reclaimed = clamp_u16(reclaimed);
+    s_summary.message_heap = s_message_heap;
+    s_summary.message_reclaimed = s_message_reclaimed;
+}
+
+#endif // ENABLE_PROFILER
@@ -0,0 +1,97 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// On-device instrumentation, compiled in only with ENABLE_PROFILER=1.
+//
+// Records tick_handler duration and worst-case re-evaluation time (time_ms
+// deltas, so millisecond resolution), redraw requests per face field, frames
+// drawn, heap_bytes_free() low/high water marks, the heap_bytes_used() peak
+// and the heap held by AppMessage buffers (with what the right-sizing saves).
+// Every PROFILER_REPORT_MINUTES a ProfileSummary is sent to the phone as one
+// byte array under MESSAGE_KEY_profile; src/pkjs/index.js decodes and logs
+// it.  When disabled every hook compiles to nothing and no outbox is opened.
+
+#include <pebble.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 0
+#endif
+
+#ifndef PROFILER_REPORT_MINUTES
+#define PROFILER_REPORT_MINUTES 15
+#endif
+
+#define PROFILER_FIELDS       8 // `redraws` entries (FACE_TEXT_MAX)
+#define PROFILE_SUMMARY_VERSION 3
+
+// Fixed index of every face field in `redraws`, whatever modules are built;
+// mirrored by PROFILE_FIELD_NAMES in src/pkjs/profile.js
+typedef enum {
+    PROFILE_FIELD_CODE,
+    PROFILE_FIELD_NAME,
+    PROFILE_FIELD_TIME,
+    PROFILE_FIELD_STRIP,
+    PROFILE_FIELD_TID,
+    PROFILE_FIELD_BEAT,
+    PROFILE_FIELD_COUNT
+} ProfileField;
+_Static_assert(PROFILE_FIELD_COUNT <= PROFILER_FIELDS, "ProfileSummary has no room for every field");
+
+// Wire format, little-endian, mirrored by decodeProfile() in src/pkjs/index.js
+typedef struct __attribute__((packed)) {
+    uint8_t  version;            // PROFILE_SUMMARY_VERSION
+    uint8_t  field_count;        // entries in `redraws`
+    uint16_t window_minutes;     // length of the window summarised
+    uint32_t ticks;              // tick_handler calls
+    uint32_t tick_total_ms;      // summed tick_handler duration
+    uint16_t tick_max_ms;        // slowest tick
+    uint16_t reeval_count;       // ticks that re-evaluated the airport pick
+    uint16_t reeval_max_ms;      // slowest re-evaluation
+    uint16_t frames;             // face layer update_proc runs
+    uint32_t heap_free_min;      // heap_bytes_free() low water mark
+    uint32_t heap_free_max;      // heap_bytes_free() high water mark
+    uint32_t heap_used_max;      // heap_bytes_used() high water mark
+    uint16_t message_heap;       // AppMessage buffers held at the end of the window
+    uint16_t message_reclaimed;  // heap those buffers no longer pin vs. fixed-size ones
+    uint16_t redraws[PROFILER_FIELDS]; // redraw requests per face field
+} ProfileSummary;
+
+#if ENABLE_PROFILER
+
+void     profiler_init(void);
+uint32_t profiler_outbox_size(void);
+void     profiler_tick_begin(void);
+void     profiler_tick_end(void);
+void     profiler_reeval_begin(void);
+void     profiler_reeval_end(bool re_evaluated);
+void     profiler_field_dirty(int field);
+void     profiler_frame(void);
+void     profiler_message_heap(uint32_t held, uint32_t reclaimed);
+
+#define PROFILER_INIT()               profiler_init()
+#define PROFILER_OUTBOX_SIZE()        profiler_outbox_size()
+#define PROFILE_TICK_BEGIN()          profiler_tick_begin()
+#define PROFILE_TICK_END()            profiler_tick_end()
+#define PROFILE_REEVAL_BEGIN()        profiler_reeval_begin()
+#define PROFILE_REEVAL_END(happened)  profiler_reeval_end(happened)
+#define PROFILE_FIELD_DIRTY(field)    profiler_field_dirty(field)
+#define PROFILE_FRAME()               profiler_frame()
+#define PROFILE_MESSAGE_HEAP(held, reclaimed) profiler_message_heap(held, reclaimed)
+
+#else
+
+#define PROFILER_INIT()               ((void)0)
+#define PROFILER_OUTBOX_SIZE()        0
+#define PROFILE_TICK_BEGIN()          ((void)0)
+#define PROFILE_TICK_END()            ((void)0)
+#define PROFILE_REEVAL_BEGIN()        ((void)0)
+#define PROFILE_REEVAL_END(happened)  ((void)(happened))
+#define PROFILE_FIELD_DIRTY(field)    ((void)(field))
+#define PROFILE_FRAME()               ((void)0)
+#define PROFILE_MESSAGE_HEAP(held, reclaimed) ((void)(held), (void)(reclaimed))
+
+#endif // ENABLE_PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,131 @@
+#include "selection_history.h"
+
+#include <string.h>
+
+static SelectionHistory s_history;
+static uint32_t s_key;
+static bool     s_dirty;
+static time_t   s_flushed_at;
+
+// --- Static helper functions ---
+
+static inline int ring_index(int i) {
+    return (s_history.first + i) % SELECTION_HISTORY_MAX;
+}
+
+static inline const SelectionRecord* record_at(int i) {
+    return &s_history.records[ring_index(i)];
+}
+
+static void history_clear(void) {
+    memset(&s_history, 0, sizeof(s_history));
+    s_history.version = SELECTION_HISTORY_VERSION;
+}
+
+// Slot of the newest record, by summing the deltas from the oldest
+static int32_t newest_slot(void) {
+    int32_t slot = s_history.base_slot;
+    for (int i = 1; i < s_history.count; ++i) slot += record_at(i)->slot_delta;
+    return slot;
+}
+
+// Drops the oldest record; the next one becomes the base
+static void drop_oldest(void) {
+    if (s_history.count > 1) s_history.base_slot += record_at(1)->slot_delta;
+    s_history.first = (uint8_t)ring_index(1);
+    s_history.count--;
+}
+
+// --- Public API ---
+
+void selection_history_load(uint32_t key, time_t now) {
+    s_key = key;
+    s_dirty = false;
+    s_flushed_at = now;
+    int len = persist_read_data(key, &s_history, sizeof(s_history));
+    if (len != (int)sizeof(s_history) || s_history.version != SELECTION_HISTORY_VERSION ||
+        s_history.count > SELECTION_HISTORY_MAX || s_history.first >= SELECTION_HISTORY_MAX) {
+        history_clear();
+    }
+}
+
+void selection_history_append(time_t eval_time, const SelectionRecord *pick) {
+    if (!pick) return;
+    int32_t slot = (int32_t)(eval_time / SELECTION_HISTORY_SLOT_SECONDS);
+    SelectionRecord rec = { 0, pick->bucket, pick->name_index };
+
+    if (s_history.count > 0) {
+        int32_t last = newest_slot();
+        SelectionRecord *newest = &s_history.records[ring_index(s_history.count - 1)];
+        if (slot == last) {
+            // Re-picked within the slot (settings change): keep the latest
+            if (newest->bucket == rec.bucket && newest->name_index == rec.name_index) return;
+            newest->bucket = rec.bucket;
+            newest->name_index = rec.name_index;
+            s_dirty = true;
+            return;
+        }
+        if (slot > last && newest->bucket == rec.bucket && newest->name_index == rec.name_index) return;
+        if (slot < last || slot - last > UINT8_MAX) {
+            // Clock set back, or too long a gap for one delta: start over
+            history_clear();
+        } else {
+            rec.slot_delta = (uint8_t)(slot - last);
+        }
+    }
+
+    if (s_history.count == 0) {
+        s_history.base_slot = slot;
+    } else if (s_history.count == SELECTION_HISTORY_MAX) {
+        drop_oldest();
+    }
+    s_history.records[ring_index(s_history.count)] = rec;
+    s_history.count++;
+    s_dirty = true;
+}
+
+void selection_history_flush(void) {
+    if (!s_dirty) return;
+    persist_write_data(s_key, &s_history, sizeof(s_history));
+    s_dirty = false;
+}
+
+void selection_history_flush_if_due(time_t now) {
+    if (!s_dirty || now - s_flushed_at < SELECTION_HISTORY_FLUSH_SECONDS) return;
+    selection_history_flush();
+    s_flushed_at = now;
+}
+
+int selection_history_count(void) {
+    return s_history.count;
+}
+
+bool selection_history_get(int back, SelectionHistoryEntry *out) {
+    if (!out || back < 0 || back >= s_history.count) return false;
+    int target = s_history.count - 1 - back;
+    int32_t slot = s_history.base_slot;
+    for (int i = 1; i <= target; ++i) slot += record_at(i)->slot_delta;
+    const SelectionRecord *rec = record_at(target);
+    out->slot_utc = (time_t)slot * SELECTION_HISTORY_SLOT_SECONDS;
+    out->bucket = rec->bucket;
+    out->name_index = rec->name_index;
+    return true;
+}
+
+int selection_history_seen_since(time_t since) {
+    int seen = 0;
+    int32_t slot = s_history.base_slot;
+    for (int i = 0; i < s_history.count; ++i) {
+        if (i > 0) slot += record_at(i)->slot_delta;
+        if (slot < (int32_t)(since / SELECTION_HISTORY_SLOT_SECONDS)) continue;
+        // Count an airport at its newest occurrence only
+        const SelectionRecord *rec = record_at(i);
+        bool again = false;
+        for (int j = i + 1; j < s_history.count && !again; ++j) {
+            const SelectionRecord *later = record_at(j);
+            again = later->bucket == rec->bucket && later->name_index == rec->name_index;
+        }
+        if (!again) seen++;
+    }
+    return seen;
+}
@@ -0,0 +1,69 @@
+#ifndef SELECTION_HISTORY_H
+#define SELECTION_HISTORY_H
+
+// Journal of the airports shown, newest last, so the face can look back over
+// the day ("you saw 48 airports").  Picks are kept as SelectionRecords in a
+// ring buffer in RAM and written to persistent storage in batches: at most
+// once an hour from selection_history_flush_if_due(), and whenever the app
+// calls selection_history_flush() (deinit, low battery).  Entries are decoded
+// from the packed ring only when read.
+
+#include <pebble.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SELECTION_HISTORY_VERSION       1
+#define SELECTION_HISTORY_MAX           80   // > 72 picks a day, fits one persist key
+#define SELECTION_HISTORY_SLOT_SECONDS  (15 * 60L)
+#define SELECTION_HISTORY_FLUSH_SECONDS 3600
+
+// One pick, the record format shared by the warm-start snapshot and the
+// journal.  slot_delta counts 15-minute slots since the previous record; a
+// snapshot is a journal of one and stores 0.
+typedef struct __attribute__((packed)) {
+    uint8_t slot_delta;
+    uint8_t bucket;       // index into the bucket table
+    uint8_t name_index;   // index within the bucket
+} SelectionRecord;
+
+// Persisted form, little-endian
+typedef struct __attribute__((packed)) {
+    uint8_t         version;    // SELECTION_HISTORY_VERSION
+    uint8_t         count;      // records in use
+    uint8_t         first;      // ring index of the oldest record
+    uint8_t         reserved;
+    int32_t         base_slot;  // slot (UTC / SELECTION_HISTORY_SLOT_SECONDS) of the oldest record
+    SelectionRecord records[SELECTION_HISTORY_MAX];
+} SelectionHistory;
+
+// A decoded entry
+typedef struct {
+    time_t  slot_utc;     // start of the 15-minute slot the pick was made in
+    uint8_t bucket;
+    uint8_t name_index;
+} SelectionHistoryEntry;
+
+// Reads the journal stored under `key` (an empty one if there is none or it
+// does not match this build); `now` starts the first flush interval
+void selection_history_load(uint32_t key, time_t now);
+
+// Records the pick made at `eval_time`.  A new pick in the same slot replaces
+// the newest record; the airport already shown is not repeated.
+void selection_history_append(time_t eval_time, const SelectionRecord *pick);
+
+// Writes the journal if it changed since the last write
+void selection_history_flush(void);
+
+// Same, but only once SELECTION_HISTORY_FLUSH_SECONDS have passed since then
+void selection_history_flush_if_due(time_t now);
+
+// Number of records held
+int selection_history_count(void);
+
+// The `back`th most recent record (0 = newest); false past the oldest
+bool selection_history_get(int back, SelectionHistoryEntry *out);
+
+// Distinct airports among the records made at or after `since`
+int selection_history_seen_since(time_t since);
+
+#endif // SELECTION_HISTORY_H
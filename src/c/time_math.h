@@ -0,0 +1,101 @@
+#ifndef TIME_MATH_H
+#define TIME_MATH_H
+
+/*
+ * time_math.h – integer time helpers shared by the clock modules
+ * -------------------------------------------------------------
+ * aplite/diorite have no FPU and no cheap 64-bit divide, so everything here
+ * sticks to int32 arithmetic:
+ *   • offsets are int quarter-hours, seconds-of-day are int32
+ *   • `UtcTime` carries the UTC breakdown of the current tick; it is advanced
+ *     by carrying +1s through sec/min/hour and only re-derived with a single
+ *     32-bit modulo when the clock jumps
+ *   • .beats need no 64-bit math: 10000/86400 reduces to 25/216 exactly
+ */
+
+#include <pebble.h>
+#include <stdint.h>
+#include <time.h>
+
+#define TM_DAY_SECONDS      86400L
+#define TM_HOUR_SECONDS     3600L
+#define TM_QUARTER_SECONDS  900L
+#define TM_QUARTERS_PER_DAY 96
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    time_t  utc;    // epoch seconds described, -1 before the first tick
+    int32_t sod;    // UTC seconds of day, 0..86399
+    uint8_t hour;   // 0..23
+    uint8_t min;    // 0..59
+    uint8_t sec;    // 0..59
+} UtcTime;
+
+#define UTC_TIME_INIT { -1, 0, 0, 0, 0 }
+
+// Wraps any (possibly negative) second count into 0..86399
+static inline int32_t time_math_wrap_sod(int32_t secs) {
+    secs %= (int32_t)TM_DAY_SECONDS;
+    return secs < 0 ? secs + (int32_t)TM_DAY_SECONDS : secs;
+}
+
+// UTC seconds of day for an epoch
+static inline int32_t time_math_utc_sod(time_t utc) {
+    return time_math_wrap_sod((int32_t)(utc % TM_DAY_SECONDS));
+}
+
+// Local seconds of day for a zone `offset_quarters` (0.25h units) from UTC
+static inline int32_t time_math_local_sod(int32_t utc_sod, int offset_quarters) {
+    return time_math_wrap_sod(utc_sod + offset_quarters * (int32_t)TM_QUARTER_SECONDS);
+}
+
+static inline void _time_math_utc_resync(UtcTime *t, time_t now) {
+    int32_t sod = time_math_utc_sod(now);
+    t->utc  = now;
+    t->sod  = sod;
+    t->hour = (uint8_t)(sod / TM_HOUR_SECONDS);
+    t->min  = (uint8_t)((sod / 60) % 60);
+    t->sec  = (uint8_t)(sod % 60);
+}
+
+// Moves `t` to `now`. Consecutive ticks only carry a second through the
+// fields; `tick_time` (local time, may be NULL) cross-checks the seconds,
+// which every zone shares with UTC since offsets are whole minutes.
+static inline void time_math_utc_advance(UtcTime *t, time_t now, const struct tm *tick_time) {
+    if (t->utc >= 0 && now == t->utc) return;
+    if (t->utc < 0 || now != t->utc + 1) {
+        _time_math_utc_resync(t, now);
+        return;
+    }
+    t->utc = now;
+    if (++t->sod == TM_DAY_SECONDS) t->sod = 0;
+    if (++t->sec == 60) {
+        t->sec = 0;
+        if (++t->min == 60) {
+            t->min = 0;
+            if (++t->hour == 24) t->hour = 0;
+        }
+    }
+    if (tick_time && tick_time->tm_sec != t->sec) _time_math_utc_resync(t, now);
+}
+
+// .beat time * 10 (0..9999) for a UTC second of day; Biel Mean Time is UTC+1
+static inline int time_math_beat10(int32_t utc_sod) {
+    int32_t bmt = utc_sod + (int32_t)TM_HOUR_SECONDS;
+    if (bmt >= TM_DAY_SECONDS) bmt -= TM_DAY_SECONDS;
+    return (int)(bmt * 25 / 216);  // == bmt * 10000 / 86400, max 2159975 fits int32
+}
+
+// Microseconds since the epoch for TID timestamps; one 32x32->64 multiply
+static inline uint64_t time_math_micros(time_t seconds, uint16_t milliseconds) {
+    return (uint64_t)(uint32_t)seconds * 1000000u + (uint32_t)milliseconds * 1000u;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIME_MATH_H */
@@ -12,13 +12,38 @@
 #define APP_LOG(level, fmt, ...)
 #endif
 
-// Clock modules
-#include "clock_beat.h"
+// Rendering and clock modules
+#include "face_layer.h"
+#include "clock_module.h"
 #include "clock_closest_airport_noon.h"
+#if CLOCK_WITH_TID
 #include "clock_tid.h"
+#endif
+#if CLOCK_WITH_BEAT
+#include "clock_beat.h"
+#endif
+#include "profiler.h"
+#include "selection_history.h"
 
 // --- Clock Modules & Settings ---
-#define SETTINGS_KEY 1
+#define SETTINGS_KEY 1  // Settings before the tagged format: one raw struct, migrated on load
+#define SELECTION_KEY 2 // Last airport pick, for instant warm starts
+#define SCHEDULE_KEY 3  // Phone schedule; the part past PERSIST_DATA_MAX_LENGTH goes under SCHEDULE_KEY + 1
+#define HISTORY_KEY 5   // Journal of the picks shown (selection_history.h)
+#define SETTINGS_VERSION_KEY 6         // schema version of the tagged settings
+#define SETTING_KEY(tag) (16 + (tag))  // one key per SettingTag
+
+// Phone schedule: ask for a new one once less than a day is left, at most
+// once an hour, and only while the phone is connected
+#define SCHEDULE_REFRESH_SECONDS (24 * 3600L)
+#define SCHEDULE_RETRY_SECONDS   3600
+
+// AppMessage sizing: the inbox holds one Clay config or one schedule chunk,
+// whichever is larger; the phone splits the schedule (splitSchedule() in
+// src/pkjs/schedule.js) so the inbox never has to fit all of it
+#define CONFIG_KEY_COUNT     10  // Clay message keys, see inbox_received_handler
+#define CONFIG_VALUE_MAX     8   // Clay sends int32s and short strings ("-1", "20")
+#define SCHEDULE_CHUNK_BYTES 100 // CHUNK_BYTES in src/pkjs/schedule.js
 
 typedef enum {
   MODE_NOON = 0,
@@ -30,57 +55,447 @@ typedef enum {
   COLOR_DARK  = 1
 } ColorScheme;
 
+// World strip: up to AIRPORT_STRIP_MAX extra targets shown above the footer
+#define STRIP_TARGET_OFF 0xFF
+
+// Live TID: frames per second are capped so a burst stays cheap
+#define LIVE_TID_MAX_HZ  20
+#define LIVE_TID_SECONDS 5 // length of a burst after a wrist tap
+
+// Glance mode: minutes only (hero code, name and minutes) until a wrist tap
+// brings the whole face back for a window of this many seconds
+#define GLANCE_MIN_SECONDS 10
+#define GLANCE_MAX_SECONDS 30
+
+// Battery tiers: full is the normal face; economy refreshes the TID and hero
+// time once a minute (.beat keeps its pace); critical shows only the airport
+// code and the hero minutes, on minute ticks.  Charging always means full.
+typedef enum {
+  POWER_FULL     = 0,
+  POWER_ECONOMY  = 1,
+  POWER_CRITICAL = 2
+} PowerTier;
+
 typedef struct AppSettings {
   TargetTimeMode target_time_mode;
   ColorScheme    color_scheme;
+  bool           world_strip;
+  uint8_t        strip_hours[AIRPORT_STRIP_MAX]; // target hour per row, or STRIP_TARGET_OFF
+  uint8_t        economy_below;  // battery percent at or below which economy starts, 0 = never
+  uint8_t        critical_below; // same for critical
+  uint8_t        live_tid_hz;    // live TID frame rate after a wrist tap, 0 = off
+  uint8_t        glance_seconds; // full face after a wrist tap in glance mode, 0 = glance off
 } AppSettings;
 
+// Settings are stored one per persist key, tagged, next to a schema
+// version.  Tags are never renumbered; a new setting takes the next tag and
+// falls back to its default on installs that predate it.
+#define SETTINGS_VERSION 2 // 1: the raw AppSettings struct under SETTINGS_KEY
+
+typedef enum {
+  SETTING_TARGET_MODE    = 0,
+  SETTING_COLOR_SCHEME   = 1,
+  SETTING_WORLD_STRIP    = 2,
+  SETTING_STRIP_HOUR_1   = 3, // rows 2 and 3 follow
+  SETTING_ECONOMY_BELOW  = 6,
+  SETTING_CRITICAL_BELOW = 7,
+  SETTING_LIVE_TID_HZ    = 8,
+  SETTING_GLANCE_SECONDS = 9,
+  SETTING_COUNT
+} SettingTag;
+
+// The work a changed setting calls for, so a recolour does not re-scan
+typedef enum {
+  APPLY_COLORS = 1 << 0,
+  APPLY_PICK   = 1 << 1, // re-evaluate the hero and strip picks
+  APPLY_TARGET = 1 << 2, // the hero target moved: also a new phone schedule
+  APPLY_POWER  = 1 << 3, // battery thresholds moved
+  APPLY_LIVE   = 1 << 4, // live TID switched or re-timed
+  APPLY_GLANCE = 1 << 5, // glance mode switched or re-timed
+  APPLY_STRIP  = 1 << 6  // strip rows only, at the hero's evaluation instant
+} SettingApply;
+
+// Version 1 layout, as written by save_settings() before the tagged format;
+// shorter records from older builds leave the later fields at their defaults
+typedef struct {
+  TargetTimeMode target_time_mode;
+  ColorScheme    color_scheme;
+  bool           world_strip;
+  uint8_t        strip_hours[3];
+  uint8_t        economy_below;
+  uint8_t        critical_below;
+} AppSettingsV1;
+
 // Forward declare helper to apply colors across UI
 static void apply_color_scheme();
+// Forward declare the wakeup scheduler entry points
+static void scheduler_reset();
+static void scheduler_wake(struct tm *tick_time);
+static void power_tier_update(BatteryChargeState charge);
+// Forward declare the live TID switch
+static void live_tid_configure();
+static void live_tid_stop();
+// Forward declare the glance mode and tap service switches
+static void glance_configure();
+static void tap_service_configure();
 
 static AppSettings settings;
 
 // --- Window and Layer Globals ---
 static Window *s_main_window;
-static TextLayer *s_airport_noon_code_layer;
-static TextLayer *s_airport_noon_name_layer;
-static TextLayer *s_airport_noon_time_layer;
-static TextLayer *s_tid_layer;
-static TextLayer *s_beat_layer;
+static Layer *s_face_layer;
+static FaceText *s_airport_noon_code_text;
+static FaceText *s_airport_noon_name_text;
+static FaceText *s_airport_noon_time_text;
+static FaceText *s_strip_text;
+
+// --- Time State ---
+static UtcTime s_utc_now = UTC_TIME_INIT; // UTC breakdown of the latest tick
+static uint8_t s_clock_fields;            // ClockTimeFields read by any module
+static time_t  s_last_wake = -1;          // UTC second of the latest wakeup
+static time_t  s_schedule_asked_at = -1;  // last schedule request, -1 = none yet
+
+// --- Wakeup Scheduler ---
+// Every clock module reports the UTC second of its next visible change and is
+// only called once that second has come.  Wakeups come from the tick service,
+// SECOND_UNIT while something is due every second and MINUTE_UNIT otherwise,
+// plus one app_timer for a deadline the minute tick would miss.  Modules due
+// in the same second share a wakeup; the timer is pushed back to the latest
+// deadline within SCHEDULER_COALESCE_SECONDS of the earliest, and deadlines
+// that close to the next minute are left to the minute tick.
+#define SCHEDULER_COALESCE_SECONDS 2
+#define SCHEDULER_TIMER_SLACK_MS   10 // land safely inside the due second
+#define SCHEDULER_NEVER            ((time_t)INT32_MAX) // module hidden by the power tier
+
+static TimeUnits s_tick_unit;              // current tick service subscription
+static bool      s_tick_subscribed;
+static AppTimer *s_wakeup_timer;
+static time_t    s_wakeup_at;              // second the timer was armed for
+static PowerTier s_power_tier = POWER_FULL;
+static bool      s_glance_burst;           // glance mode: tap window open, full face
+
+// Glance mode with no tap window open: minutes only
+static bool glance_resting() {
+  return settings.glance_seconds > 0 && !s_glance_burst;
+}
 
 // --- Layout Constants ---
 // These can be tweaked for different visual arrangements.
 static const int LAYER_AIRPORT_CODE_HEIGHT = 28;
 static const int LAYER_AIRPORT_NAME_HEIGHT = 28;
 static const int LAYER_AIRPORT_TIME_HEIGHT = 42; // Approximate height for FONT_KEY_LECO_42_NUMBERS
-static const int FOOTER_AREA_HEIGHT = 48;
+static const int FOOTER_AREA_HEIGHT = 48; // kept without the footer modules, so the hero stays put
+#if CLOCK_WITH_TID || CLOCK_WITH_BEAT
 static const int FOOTER_TID_HEIGHT = 28;
+#endif
+static const int LAYER_STRIP_HEIGHT = 16; // FONT_KEY_GOTHIC_14, between hero time and footer
 
 // Padding and Adjustments
 static const int AIRPORT_NAME_X_PADDING = 3;
 static const int AIRPORT_NAME_WIDTH_ADJUST = 5; // Total reduction (e.g., 2*padding + 1)
 static const int AIRPORT_TIME_Y_ADJUST = -7; // Fine-tuning vertical position
+#if CLOCK_WITH_TID
 static const int FOOTER_TID_Y_ADJUST = -1;
+#endif
+#if CLOCK_WITH_BEAT
 static const int FOOTER_BEAT_Y_ADJUST = -3;
+#endif
 
 // --- Pebble Window Management ---
 
 // --- Settings Load/Save/Receive ---
+static int setting_get(const AppSettings *from, SettingTag tag) {
+  switch (tag) {
+    case SETTING_TARGET_MODE:    return from->target_time_mode;
+    case SETTING_COLOR_SCHEME:   return from->color_scheme;
+    case SETTING_WORLD_STRIP:    return from->world_strip;
+    case SETTING_ECONOMY_BELOW:  return from->economy_below;
+    case SETTING_CRITICAL_BELOW: return from->critical_below;
+    case SETTING_LIVE_TID_HZ:    return from->live_tid_hz;
+    case SETTING_GLANCE_SECONDS: return from->glance_seconds;
+    default:                     return from->strip_hours[tag - SETTING_STRIP_HOUR_1];
+  }
+}
+
+static void setting_set(AppSettings *to, SettingTag tag, int value) {
+  switch (tag) {
+    case SETTING_TARGET_MODE:    to->target_time_mode = (value == MODE_5PM) ? MODE_5PM : MODE_NOON; break;
+    case SETTING_COLOR_SCHEME:   to->color_scheme = (value == COLOR_DARK) ? COLOR_DARK : COLOR_LIGHT; break;
+    case SETTING_WORLD_STRIP:    to->world_strip = value != 0; break;
+    case SETTING_ECONOMY_BELOW:  to->economy_below = (uint8_t)value; break;
+    case SETTING_CRITICAL_BELOW: to->critical_below = (uint8_t)value; break;
+    case SETTING_LIVE_TID_HZ:
+      to->live_tid_hz = (value > 0 && value <= LIVE_TID_MAX_HZ) ? (uint8_t)value : 0;
+      break;
+    case SETTING_GLANCE_SECONDS:
+      to->glance_seconds = value <= 0 ? 0 : value < GLANCE_MIN_SECONDS ? GLANCE_MIN_SECONDS
+                         : value > GLANCE_MAX_SECONDS ? GLANCE_MAX_SECONDS : (uint8_t)value;
+      break;
+    default:
+      to->strip_hours[tag - SETTING_STRIP_HOUR_1] = (value >= 0 && value < 24) ? (uint8_t)value : STRIP_TARGET_OFF;
+      break;
+  }
+}
+
+static uint32_t setting_apply(SettingTag tag) {
+  switch (tag) {
+    case SETTING_TARGET_MODE:    return APPLY_PICK | APPLY_TARGET;
+    case SETTING_COLOR_SCHEME:   return APPLY_COLORS;
+    case SETTING_ECONOMY_BELOW:
+    case SETTING_CRITICAL_BELOW: return APPLY_POWER;
+    case SETTING_LIVE_TID_HZ:    return APPLY_LIVE;
+    case SETTING_GLANCE_SECONDS: return APPLY_GLANCE;
+    default:                     return APPLY_STRIP; // the hero stays put mid-slot
+  }
+}
+
+static void settings_defaults(AppSettings *to) {
+  to->target_time_mode = MODE_NOON;
+  to->color_scheme    = COLOR_LIGHT;
+  to->world_strip     = false;
+  to->strip_hours[0]  = 9;
+  to->strip_hours[1]  = 17;
+  to->strip_hours[2]  = 0;
+  to->economy_below   = 30;
+  to->critical_below  = 10;
+  to->live_tid_hz     = 0;
+  to->glance_seconds  = 0;
+}
+
+// Writes every setting that differs from the stored one and returns the
+// work the differences call for
+static uint32_t settings_commit(const AppSettings *next) {
+  uint32_t apply = 0;
+  for (int tag = 0; tag < SETTING_COUNT; ++tag) {
+    int value = setting_get(next, (SettingTag)tag);
+    if (value == setting_get(&settings, (SettingTag)tag)) continue;
+    persist_write_int(SETTING_KEY(tag), value);
+    apply |= setting_apply((SettingTag)tag);
+  }
+  settings = *next;
+  return apply;
+}
+
+// Version 1 struct to tagged keys, once
+static void settings_migrate_v1() {
+  AppSettingsV1 old;
+  AppSettings defaults;
+  settings_defaults(&defaults);
+  old.target_time_mode = defaults.target_time_mode;
+  old.color_scheme     = defaults.color_scheme;
+  old.world_strip      = defaults.world_strip;
+  memcpy(old.strip_hours, defaults.strip_hours, sizeof(old.strip_hours));
+  old.economy_below    = defaults.economy_below;
+  old.critical_below   = defaults.critical_below;
+  if (persist_read_data(SETTINGS_KEY, &old, sizeof(old)) > 0) {
+    settings.target_time_mode = old.target_time_mode;
+    settings.color_scheme     = old.color_scheme;
+    settings.world_strip      = old.world_strip;
+    memcpy(settings.strip_hours, old.strip_hours, sizeof(settings.strip_hours));
+    settings.economy_below    = old.economy_below;
+    settings.critical_below   = old.critical_below;
+    for (int tag = 0; tag < SETTING_COUNT; ++tag) {
+      if (setting_get(&settings, (SettingTag)tag) != setting_get(&defaults, (SettingTag)tag)) {
+        persist_write_int(SETTING_KEY(tag), setting_get(&settings, (SettingTag)tag));
+      }
+    }
+    persist_delete(SETTINGS_KEY);
+    APP_LOG(APP_LOG_LEVEL_INFO, "Settings migrated from version 1");
+  }
+  persist_write_int(SETTINGS_VERSION_KEY, SETTINGS_VERSION);
+}
+
+// Defaults, overridden by every tag that has been stored
 static void load_settings() {
-  // Set default values
-  settings.target_time_mode = MODE_NOON;
-  settings.color_scheme    = COLOR_LIGHT;
-  // Read settings from persistent storage, if they exist
-  persist_read_data(SETTINGS_KEY, &settings, sizeof(settings));
+  settings_defaults(&settings);
+  if (persist_read_int(SETTINGS_VERSION_KEY) < SETTINGS_VERSION) {
+    settings_migrate_v1();
+    return;
+  }
+  for (int tag = 0; tag < SETTING_COUNT; ++tag) {
+    if (persist_exists(SETTING_KEY(tag))) {
+      setting_set(&settings, (SettingTag)tag, persist_read_int(SETTING_KEY(tag)));
+    }
+  }
+}
+
+// --- Selection Snapshot Load/Save ---
+static long target_seconds_for_mode(TargetTimeMode mode) {
+  return (mode == MODE_5PM) ? (17 * 3600L) : (12 * 3600L);
+}
+
+// Hands the enabled strip targets to the airport module
+static void apply_strip_settings() {
+  long targets[AIRPORT_STRIP_MAX];
+  int count = 0;
+  for (int i = 0; settings.world_strip && i < AIRPORT_STRIP_MAX; ++i) {
+    if (settings.strip_hours[i] < 24) targets[count++] = settings.strip_hours[i] * 3600L;
+  }
+  clock_closest_airport_noon_set_strip(targets, count);
 }
 
-static void save_settings() {
-  persist_write_data(SETTINGS_KEY, &settings, sizeof(settings));
+// Strip line, e.g. "09 NRT  17 LHR  00 LAX"
+static void update_strip_text() {
+  static char s_strip_buf[AIRPORT_STRIP_MAX * 8];
+  size_t len = 0;
+  int row = 0;
+  s_strip_buf[0] = '\0';
+  bool shown = settings.world_strip && s_power_tier != POWER_CRITICAL;
+  for (int i = 0; shown && i < AIRPORT_STRIP_MAX; ++i) {
+    if (settings.strip_hours[i] >= 24) continue;
+    len += snprintf(s_strip_buf + len, sizeof(s_strip_buf) - len, "%s%02d %s",
+                    row ? "  " : "", settings.strip_hours[i], clock_closest_airport_noon_strip_code(row));
+    row++;
+  }
+  face_text_set_text(s_strip_text, s_strip_buf);
+}
+
+// Restores the last pick if it is still valid for the current slot, so the
+// first frame needs no scan and shows the same airport as before.
+static void load_selection(time_t now) {
+  AirportSelection sel;
+  if (persist_read_data(SELECTION_KEY, &sel, sizeof(sel)) != (int)sizeof(sel)) return;
+  if (clock_closest_airport_noon_restore_selection(&sel, now, target_seconds_for_mode(settings.target_time_mode))) {
+    APP_LOG(APP_LOG_LEVEL_INFO, "Selection snapshot restored");
+  }
+}
+
+static void save_selection() {
+  AirportSelection sel;
+  if (clock_closest_airport_noon_get_selection(&sel)) {
+    persist_write_data(SELECTION_KEY, &sel, sizeof(sel));
+  }
+}
+
+// Journals a new pick; the journal reaches flash in hourly batches
+static void record_selection(time_t now) {
+  AirportSelection sel;
+  if (clock_closest_airport_noon_get_selection(&sel)) {
+    selection_history_append(sel.eval_time, &sel.pick);
+  }
+  selection_history_flush_if_due(now);
+}
+
+// --- Phone Schedule Load/Save/Request ---
+static void load_schedule() {
+  uint8_t buf[sizeof(AirportSchedule)];
+  int len = persist_read_data(SCHEDULE_KEY, buf, PERSIST_DATA_MAX_LENGTH);
+  if (len <= 0) return;
+  if (len == PERSIST_DATA_MAX_LENGTH) {
+    int rest = persist_read_data(SCHEDULE_KEY + 1, buf + len, sizeof(buf) - len);
+    if (rest > 0) len += rest;
+  }
+  if (clock_closest_airport_noon_set_schedule(buf, (size_t)len)) {
+    APP_LOG(APP_LOG_LEVEL_INFO, "Phone schedule restored");
+  }
+}
+
+static void save_schedule(const uint8_t *data, size_t len) {
+  size_t head = len < PERSIST_DATA_MAX_LENGTH ? len : PERSIST_DATA_MAX_LENGTH;
+  persist_write_data(SCHEDULE_KEY, data, head);
+  if (len > head) {
+    persist_write_data(SCHEDULE_KEY + 1, data + head, len - head);
+  } else {
+    persist_delete(SCHEDULE_KEY + 1);
+  }
+}
+
+// --- AppMessage Buffers ---
+static bool     s_messaging_open;    // opened once the phone has been seen
+static uint32_t s_message_heap;      // inbox + outbox bytes held
+static uint32_t s_message_outbox;    // outbox part of that
+static uint8_t *s_schedule_rx;       // schedule being reassembled, NULL between transfers
+static uint16_t s_schedule_rx_len;   // bytes received so far
+static uint16_t s_schedule_rx_total; // bytes announced by the first chunk
+
+// Reports the heap held for messaging, and what it saves over an inbox that
+// always fits a whole schedule
+static void messaging_report_heap() {
+  uint32_t held = s_message_heap + (s_schedule_rx ? s_schedule_rx_total : 0);
+  uint32_t fixed = dict_calc_buffer_size(1, sizeof(AirportSchedule)) + s_message_outbox;
+  uint32_t reclaimed = held < fixed ? fixed - held : 0;
+  APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage heap: %d B held, %d B reclaimed", (int)held, (int)reclaimed);
+  PROFILE_MESSAGE_HEAP(held, reclaimed);
+}
+
+static void schedule_rx_release() {
+  if (!s_schedule_rx) return;
+  free(s_schedule_rx);
+  s_schedule_rx = NULL;
+  messaging_report_heap();
+}
+
+// Asks the phone for a fresh schedule when the current one runs low; without
+// one the airport module keeps using its own table
+static void schedule_maybe_request(time_t now) {
+  if (!s_messaging_open) return;
+  long target = target_seconds_for_mode(settings.target_time_mode);
+  if (clock_closest_airport_noon_schedule_until(target) - now >= SCHEDULE_REFRESH_SECONDS) return;
+  if (s_schedule_asked_at >= 0 && now - s_schedule_asked_at < SCHEDULE_RETRY_SECONDS) return;
+  if (!connection_service_peek_pebble_app_connection()) return;
+
+  AirportScheduleRequest request;
+  if (!clock_closest_airport_noon_schedule_request(&request, target)) return;
+  DictionaryIterator *iter;
+  if (app_message_outbox_begin(&iter) != APP_MSG_OK) return; // busy: next slot tries again
+  dict_write_data(iter, MESSAGE_KEY_scheduleRequest, (const uint8_t *)&request, sizeof(request));
+  if (app_message_outbox_send() == APP_MSG_OK) s_schedule_asked_at = now;
+}
+
+// Clay sends select values as strings and toggles as integers
+static int tuple_int(const Tuple *t) {
+  return (t->type == TUPLE_CSTRING) ? atoi(t->value->cstring) : (int)t->value->int32;
+}
+
+// One chunk of a phone schedule.  The reassembly buffer is allocated by the
+// first chunk and freed after the last; a chunk out of order drops the
+// transfer, and the next request starts over.
+static void schedule_receive_chunk(DictionaryIterator *iter, const Tuple *chunk) {
+  Tuple *offset_t = dict_find(iter, MESSAGE_KEY_scheduleOffset);
+  Tuple *length_t = dict_find(iter, MESSAGE_KEY_scheduleLength);
+  int offset = offset_t ? tuple_int(offset_t) : 0;
+  int total = length_t ? tuple_int(length_t) : (int)chunk->length;
+
+  if (offset == 0) {
+    schedule_rx_release();
+    if (total <= 0 || total > (int)sizeof(AirportSchedule)) return;
+    s_schedule_rx = malloc((size_t)total);
+    if (!s_schedule_rx) return;
+    s_schedule_rx_len = 0;
+    s_schedule_rx_total = (uint16_t)total;
+    messaging_report_heap();
+  }
+  if (!s_schedule_rx || offset != s_schedule_rx_len || total != s_schedule_rx_total ||
+      offset + chunk->length > total) {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Phone schedule chunk at %d dropped", offset);
+    schedule_rx_release();
+    return;
+  }
+  memcpy(s_schedule_rx + offset, chunk->value->data, chunk->length);
+  s_schedule_rx_len += chunk->length;
+  if (s_schedule_rx_len < s_schedule_rx_total) return;
+
+  if (clock_closest_airport_noon_set_schedule(s_schedule_rx, s_schedule_rx_len)) {
+    save_schedule(s_schedule_rx, s_schedule_rx_len);
+  } else {
+    APP_LOG(APP_LOG_LEVEL_WARNING, "Phone schedule rejected");
+  }
+  schedule_rx_release();
 }
 
 static void inbox_received_handler(DictionaryIterator *iter, void *context) {
   (void)context;
   APP_LOG(APP_LOG_LEVEL_INFO, "Inbox received!");
+  // A phone schedule comes on its own; it applies from the next slot
+  Tuple *schedule_t = dict_find(iter, MESSAGE_KEY_schedule);
+  if (schedule_t) {
+    schedule_receive_chunk(iter, schedule_t);
+    return;
+  }
+
+  // Read the config into a copy; only what differs is stored and applied
+  AppSettings next = settings;
+
   // Read timeAlignmentMode preference
   Tuple *target_time_mode_t = dict_find(iter, MESSAGE_KEY_timeAlignmentMode);
   if (target_time_mode_t) {
@@ -88,11 +503,11 @@ static void inbox_received_handler(DictionaryIterator *iter, void *context) {
     // Convert received ASCII value ('0' or '1') to enum
     int received_value = (int)target_time_mode_t->value->int32;
     if (received_value == 49) { // ASCII for '1'
-      settings.target_time_mode = MODE_5PM;
+      next.target_time_mode = MODE_5PM;
     } else { // Default to Noon for '0' (ASCII 48) or unexpected values
-      settings.target_time_mode = MODE_NOON;
+      next.target_time_mode = MODE_NOON;
     }
-    APP_LOG(APP_LOG_LEVEL_INFO, "Setting mode to: %d", settings.target_time_mode);
+    APP_LOG(APP_LOG_LEVEL_INFO, "Setting mode to: %d", next.target_time_mode);
   } else {
     APP_LOG(APP_LOG_LEVEL_WARNING, "Key timeAlignmentMode not found!");
   }
@@ -101,111 +516,523 @@ static void inbox_received_handler(DictionaryIterator *iter, void *context) {
   Tuple *color_scheme_t = dict_find(iter, MESSAGE_KEY_colorScheme);
   if (color_scheme_t) {
     int recv_val = (int)color_scheme_t->value->int32;
-    settings.color_scheme = (recv_val == 49) ? COLOR_DARK : COLOR_LIGHT;
+    next.color_scheme = (recv_val == 49) ? COLOR_DARK : COLOR_LIGHT;
   }
 
-  // Save the new settings
-  save_settings();
+  // Read world strip toggle and targets ("-1" is off)
+  Tuple *world_strip_t = dict_find(iter, MESSAGE_KEY_worldStrip);
+  if (world_strip_t) {
+    setting_set(&next, SETTING_WORLD_STRIP, tuple_int(world_strip_t));
+  }
+  const uint32_t strip_keys[AIRPORT_STRIP_MAX] = {
+    MESSAGE_KEY_stripTarget1, MESSAGE_KEY_stripTarget2, MESSAGE_KEY_stripTarget3
+  };
+  for (int i = 0; i < AIRPORT_STRIP_MAX; ++i) {
+    Tuple *strip_t = dict_find(iter, strip_keys[i]);
+    if (strip_t) setting_set(&next, (SettingTag)(SETTING_STRIP_HOUR_1 + i), tuple_int(strip_t));
+  }
 
-  // Apply updated colors immediately
-  apply_color_scheme();
+  // Read battery tier thresholds (percent, "0" is never)
+  Tuple *economy_t = dict_find(iter, MESSAGE_KEY_economyBelow);
+  if (economy_t) setting_set(&next, SETTING_ECONOMY_BELOW, tuple_int(economy_t));
+  Tuple *critical_t = dict_find(iter, MESSAGE_KEY_criticalBelow);
+  if (critical_t) setting_set(&next, SETTING_CRITICAL_BELOW, tuple_int(critical_t));
 
-  // Potentially force an update if needed
-  s_last_re_eval_time = -1; // Force re-evaluation
-}
+  // Read the live TID rate ("0" is off)
+  Tuple *live_tid_t = dict_find(iter, MESSAGE_KEY_liveTid);
+  if (live_tid_t) setting_set(&next, SETTING_LIVE_TID_HZ, tuple_int(live_tid_t));
 
-// Handles updates from the TickTimerService
-static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-  (void)tick_time;
-  (void)units_changed;
-  time_t seconds;
-  uint16_t milliseconds;
-  time_ms(&seconds, &milliseconds);
+  // Read the glance window ("0" is glance mode off)
+  Tuple *glance_t = dict_find(iter, MESSAGE_KEY_glanceSeconds);
+  if (glance_t) setting_set(&next, SETTING_GLANCE_SECONDS, tuple_int(glance_t));
 
-  APP_LOG(APP_LOG_LEVEL_DEBUG, "Tick! Current mode: %d", settings.target_time_mode);
-  // Determine target seconds based on setting
-  long target_seconds = (settings.target_time_mode == MODE_5PM) ? (17 * 3600L) : (12 * 3600L);
+  // Store the changed keys, then redo only the work they call for
+  uint32_t apply = settings_commit(&next);
+  APP_LOG(APP_LOG_LEVEL_INFO, "Settings changed: 0x%x", (unsigned)apply);
+  if (apply & APPLY_COLORS) apply_color_scheme();
+  if (apply & APPLY_PICK) {
+    apply_strip_settings();
+    s_last_re_eval_time = -1; // Force re-evaluation
+    scheduler_reset();
+  } else if (apply & APPLY_STRIP) {
+    apply_strip_settings();
+    clock_closest_airport_noon_refresh_strip();
+    if (s_strip_text) update_strip_text();
+  }
+  if (apply & APPLY_TARGET) s_schedule_asked_at = -1; // a new target needs a new schedule right away
+  if (apply & APPLY_POWER) power_tier_update(battery_state_service_peek());
+  if (apply & APPLY_LIVE) live_tid_configure();
+  if (apply & APPLY_GLANCE) glance_configure();
+  if (apply & (APPLY_LIVE | APPLY_GLANCE)) tap_service_configure();
+  if (apply & (APPLY_PICK | APPLY_POWER | APPLY_GLANCE)) scheduler_wake(NULL);
+}
 
-  // Hero: Closest Noon (update city and time layers)
-  clock_closest_airport_noon_update(s_airport_noon_code_layer, s_airport_noon_time_layer, seconds, target_seconds);
+// Opens AppMessage with buffers sized for the messages this face exchanges.
+// The SDK cannot resize or close it again, so this waits until the phone is
+// connected: a face that never sees the phone never pins the buffers.
+static void messaging_open() {
+  if (s_messaging_open) return;
+  uint32_t tuple_bytes = dict_calc_buffer_size(1, CONFIG_VALUE_MAX) - dict_calc_buffer_size(0);
+  uint32_t config_size = dict_calc_buffer_size(0) + CONFIG_KEY_COUNT * tuple_bytes;
+  uint32_t chunk_size = dict_calc_buffer_size(3, SCHEDULE_CHUNK_BYTES, sizeof(int32_t), sizeof(int32_t));
+  uint32_t inbox_size = config_size > chunk_size ? config_size : chunk_size;
+  // The outbox carries schedule requests and profiler summaries
+  uint32_t outbox_size = PROFILER_OUTBOX_SIZE();
+  uint32_t request_size = dict_calc_buffer_size(1, sizeof(AirportScheduleRequest));
+  if (outbox_size < request_size) outbox_size = request_size;
 
-  // Update airport name below the code
-  text_layer_set_text(s_airport_noon_name_layer, s_selected_name);
-  // Footer: TID (larger) and Beat (smaller)
-  clock_tid_update(s_tid_layer, seconds, milliseconds);
-  clock_beat_update(s_beat_layer, seconds);
+  app_message_register_inbox_received(inbox_received_handler);
+  AppMessageResult result = app_message_open(inbox_size, outbox_size);
+  if (result != APP_MSG_OK) {
+    APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to open AppMessage: %d", result);
+    return;
+  }
+  APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage opened: %d B inbox, %d B outbox", (int)inbox_size, (int)outbox_size);
+  s_messaging_open = true;
+  s_message_heap = inbox_size + outbox_size;
+  s_message_outbox = outbox_size;
+  messaging_report_heap();
+  connection_service_unsubscribe(); // open for good, nothing left to wait for
+  schedule_maybe_request(time(NULL));
 }
 
-static void main_window_load(Window *window) {
-  Layer *window_layer = window_get_root_layer(window);
-  GRect bounds = layer_get_bounds(window_layer);
+static void app_connection_handler(bool connected) {
+  if (connected) messaging_open();
+}
+
+// --- Clock Module Registry ---
+// The modules compiled into this build (clock_module.h), in the order their
+// fields are created.  Every field is tagged with its ProfileField, so the
+// profiler's redraw counts keep their names in builds without TID or .beat.
 
+// Hero: closest-noon airport code, name and time, and the world strip that
+// comes from the same pass
+static void noon_module_init(GRect bounds) {
   // Calculated heights based on constants
   int hero_h = bounds.size.h - FOOTER_AREA_HEIGHT;
   const int usable_h = hero_h - LAYER_AIRPORT_CODE_HEIGHT - LAYER_AIRPORT_NAME_HEIGHT;
 
   // Create city name line (IATA Code)
-  s_airport_noon_code_layer = clock_closest_airport_noon_code_init(
-      GRect(0, 0, bounds.size.w, LAYER_AIRPORT_CODE_HEIGHT), window_layer);
-  text_layer_set_text_alignment(s_airport_noon_code_layer, GTextAlignmentCenter);
+  s_airport_noon_code_text = clock_closest_airport_noon_code_init(
+      GRect(0, 0, bounds.size.w, LAYER_AIRPORT_CODE_HEIGHT));
+  face_text_set_profile_field(s_airport_noon_code_text, PROFILE_FIELD_CODE);
 
   // Create airport name line below the IATA code
-  s_airport_noon_name_layer = text_layer_util_create(GRect(
+  s_airport_noon_name_text = face_text_create(GRect(
     AIRPORT_NAME_X_PADDING,
-    LAYER_AIRPORT_CODE_HEIGHT, // Positioned below the code layer
+    LAYER_AIRPORT_CODE_HEIGHT, // Positioned below the code line
     bounds.size.w - AIRPORT_NAME_WIDTH_ADJUST,
     LAYER_AIRPORT_NAME_HEIGHT),
-    window_layer,
     "", // Initial text, will be updated by tick_handler
     FONT_KEY_GOTHIC_24);
-  // text_layer_set_text_alignment is GTextAlignmentCenter by default in text_layer_util_create
-  // text_layer_set_background_color is GColorClear by default in text_layer_util_create
-  // layer_add_child is handled by text_layer_util_create
+  face_text_set_profile_field(s_airport_noon_name_text, PROFILE_FIELD_NAME);
+  // Fields are center aligned by default in face_text_create
 
   // Create hero time line, vertically centered in its usable area
   int time_y = LAYER_AIRPORT_CODE_HEIGHT + LAYER_AIRPORT_NAME_HEIGHT + (usable_h - LAYER_AIRPORT_TIME_HEIGHT) / 2 + AIRPORT_TIME_Y_ADJUST;
-  s_airport_noon_time_layer = clock_closest_airport_noon_time_init(
-      GRect(0, time_y, bounds.size.w, LAYER_AIRPORT_TIME_HEIGHT), window_layer);
+  s_airport_noon_time_text = clock_closest_airport_noon_time_init(
+      GRect(0, time_y, bounds.size.w, LAYER_AIRPORT_TIME_HEIGHT));
+  face_text_set_profile_field(s_airport_noon_time_text, PROFILE_FIELD_TIME);
+
+  // World strip line just above the footer (empty unless enabled)
+  s_strip_text = face_text_create(GRect(0, hero_h - LAYER_STRIP_HEIGHT, bounds.size.w, LAYER_STRIP_HEIGHT),
+                                  "", FONT_KEY_GOTHIC_14);
+  face_text_set_profile_field(s_strip_text, PROFILE_FIELD_STRIP);
+}
+
+static void noon_module_deinit() {
+  clock_closest_airport_noon_deinit(s_airport_noon_code_text);
+  face_text_destroy(s_airport_noon_name_text);
+  clock_closest_airport_noon_deinit(s_airport_noon_time_text);
+  face_text_destroy(s_strip_text);
+}
+
+static void noon_module_render(const ClockTime *now) {
+  long target_seconds = target_seconds_for_mode(settings.target_time_mode);
+  time_t prev_eval_time = s_last_re_eval_time;
+  PROFILE_REEVAL_BEGIN();
+  clock_closest_airport_noon_update(s_airport_noon_code_text, s_airport_noon_time_text, now->utc, target_seconds);
+  PROFILE_REEVAL_END(s_last_re_eval_time != prev_eval_time);
+  // Update airport name below the code (only redraws when it changed)
+  if (s_power_tier != POWER_CRITICAL) face_text_set_text(s_airport_noon_name_text, s_selected_name);
+  if (s_last_re_eval_time != prev_eval_time) {
+    update_strip_text();
+    record_selection(now->seconds);
+    schedule_maybe_request(now->seconds);
+  }
+}
 
-  // Setup footer area
-  int w = bounds.size.w;
-  int h = bounds.size.h;
-  int footer_y = h - FOOTER_AREA_HEIGHT;
+static time_t noon_module_next_change(const ClockTime *now) {
+  return clock_closest_airport_noon_next_change(now->utc);
+}
+
+// Critical keeps the code and minutes only
+static void noon_module_hide() {
+  face_text_set_text(s_airport_noon_name_text, "");
+}
+
+#if CLOCK_WITH_TID
+// Footer line 1: TID (bigger, center aligned)
+static FaceText *s_tid_text;
+
+static void tid_module_init(GRect bounds) {
+  int footer_y = bounds.size.h - FOOTER_AREA_HEIGHT;
+  s_tid_text = clock_tid_init(GRect(0, footer_y + FOOTER_TID_Y_ADJUST, bounds.size.w, FOOTER_TID_HEIGHT));
+  face_text_set_font(s_tid_text, FONT_KEY_GOTHIC_24_BOLD);
+  face_text_set_profile_field(s_tid_text, PROFILE_FIELD_TID);
+}
+
+static void tid_module_deinit() {
+  clock_tid_deinit(s_tid_text);
+}
+
+static void tid_module_render(const ClockTime *now) {
+  clock_tid_update(s_tid_text, now->seconds, now->milliseconds);
+}
+
+static time_t tid_module_next_change(const ClockTime *now) {
+  return clock_tid_next_change(now->seconds);
+}
+
+static void tid_module_hide() {
+  clock_tid_hide(s_tid_text);
+}
+
+// Live TID: a wrist tap runs the TID from its own app_timer at
+// settings.live_tid_hz for LIVE_TID_SECONDS, on top of the scheduler's 1 Hz
+// updates.  Only the TID field changes, and only its changed tail is
+// copied.  A frame is skipped while the previous one has not been drawn, so
+// a busy compositor never builds a queue.  The burst ends by itself, and the
+// tap service is only subscribed while the setting (or glance mode) is on.
+static AppTimer *s_live_timer;
+static time_t    s_live_until;     // UTC second the burst ends
+
+static void live_tid_stop() {
+  if (s_live_timer) app_timer_cancel(s_live_timer);
+  s_live_timer = NULL;
+}
+
+static void live_tid_timer_handler(void *context) {
+  (void)context;
+  s_live_timer = NULL;
+  time_t seconds;
+  uint16_t milliseconds;
+  time_ms(&seconds, &milliseconds);
+  if (seconds >= s_live_until || s_power_tier != POWER_FULL || glance_resting() || !settings.live_tid_hz) return;
+  if (!face_layer_frame_pending()) clock_tid_update(s_tid_text, seconds, milliseconds);
+  s_live_timer = app_timer_register(1000 / settings.live_tid_hz, live_tid_timer_handler, NULL);
+}
+
+static void live_tid_tap() {
+  if (s_power_tier != POWER_FULL || glance_resting() || !settings.live_tid_hz || !s_face_layer) return;
+  s_live_until = time(NULL) + LIVE_TID_SECONDS; // a tap during a burst extends it
+  if (!s_live_timer) s_live_timer = app_timer_register(0, live_tid_timer_handler, NULL);
+}
+
+// Follows the setting: any burst is ended when it is switched off
+static void live_tid_configure() {
+  if (!settings.live_tid_hz) live_tid_stop();
+}
+#else
+static void live_tid_configure() {}
+static void live_tid_stop() {}
+static void live_tid_tap() {}
+#endif
+
+#if CLOCK_WITH_BEAT
+// Footer line 2: Beat (smaller, center aligned)
+static FaceText *s_beat_text;
+
+static void beat_module_init(GRect bounds) {
+  int footer_y = bounds.size.h - FOOTER_AREA_HEIGHT;
   int beat_h = FOOTER_AREA_HEIGHT - FOOTER_TID_HEIGHT; // Calculated
+  s_beat_text = clock_beat_init(GRect(0, footer_y + FOOTER_TID_HEIGHT + FOOTER_BEAT_Y_ADJUST, bounds.size.w, beat_h));
+  face_text_set_font(s_beat_text, FONT_KEY_GOTHIC_18);
+  face_text_set_profile_field(s_beat_text, PROFILE_FIELD_BEAT);
+}
+
+static void beat_module_deinit() {
+  clock_beat_deinit(s_beat_text);
+}
+
+static void beat_module_render(const ClockTime *now) {
+  clock_beat_update(s_beat_text, now->utc);
+}
+
+static time_t beat_module_next_change(const ClockTime *now) {
+  return clock_beat_next_change(now->utc);
+}
+
+static void beat_module_hide() {
+  clock_beat_hide(s_beat_text);
+}
+#endif
+
+static const ClockModule CLOCK_MODULES[] = {
+  { "noon", CLOCK_TIME_UTC, CLOCK_ECONOMY_MINUTES | CLOCK_CRITICAL_SHOWN | CLOCK_GLANCE_SHOWN,
+    noon_module_init, noon_module_deinit, noon_module_render, noon_module_next_change, noon_module_hide },
+#if CLOCK_WITH_TID
+  { "tid", CLOCK_TIME_MILLIS, CLOCK_ECONOMY_MINUTES,
+    tid_module_init, tid_module_deinit, tid_module_render, tid_module_next_change, tid_module_hide },
+#endif
+#if CLOCK_WITH_BEAT
+  { "beat", CLOCK_TIME_UTC, 0, // .beat keeps its pace in economy
+    beat_module_init, beat_module_deinit, beat_module_render, beat_module_next_change, beat_module_hide },
+#endif
+};
+
+#define CLOCK_COUNT ((int)(sizeof(CLOCK_MODULES) / sizeof(CLOCK_MODULES[0])))
+
+static time_t s_next_due[CLOCK_COUNT]; // per module, 0 = due now
+
+// --- Battery Tiers ---
+
+static PowerTier power_tier_for(BatteryChargeState charge) {
+  if (charge.is_charging || charge.is_plugged) return POWER_FULL;
+  if (charge.charge_percent <= settings.critical_below) return POWER_CRITICAL;
+  if (charge.charge_percent <= settings.economy_below) return POWER_ECONOMY;
+  return POWER_FULL;
+}
+
+// Fits the face to the power tier and glance mode: hidden fields are cleared
+// here and the rest come back on the wakeup that follows, since every module
+// is made due again.  The hero code is left alone, so it never blinks.
+static void face_detail_update() {
+  bool critical = s_power_tier == POWER_CRITICAL;
+  bool resting = glance_resting();
+  clock_closest_airport_noon_set_seconds(!critical && !resting);
+  if (s_face_layer) {
+    for (int i = 0; i < CLOCK_COUNT; ++i) {
+      const ClockModule *module = &CLOCK_MODULES[i];
+      if (module->hide && (critical || (resting && !(module->tiers & CLOCK_GLANCE_SHOWN)))) module->hide();
+    }
+  }
+  if (s_strip_text) update_strip_text();
+  scheduler_reset();
+}
+
+// Switches tier
+static void power_tier_update(BatteryChargeState charge) {
+  PowerTier tier = power_tier_for(charge);
+  if (tier == s_power_tier) return;
+  APP_LOG(APP_LOG_LEVEL_INFO, "Power tier %d -> %d at %d%%", s_power_tier, tier, charge.charge_percent);
+  if (tier > s_power_tier) selection_history_flush(); // the battery may not last the hour
+  s_power_tier = tier;
+  if (tier != POWER_FULL) live_tid_stop();
+  face_detail_update();
+}
+
+static void battery_handler(BatteryChargeState charge) {
+  PowerTier before = s_power_tier;
+  power_tier_update(charge);
+  if (s_power_tier != before) scheduler_wake(NULL);
+}
+
+// --- Glance Mode & Wrist Taps ---
+// With settings.glance_seconds set the face rests on minutes: only the
+// CLOCK_GLANCE_SHOWN modules (the hero code, name and minutes) are kept,
+// and the tick service drops to MINUTE_UNIT.  The :00/:15/:30 slots fall on
+// minute ticks, so re-evaluation stays exact.  A wrist tap opens a window of
+// glance_seconds on the face the power tier allows; a tap within it extends it.
+
+static AppTimer *s_glance_timer;
+static bool      s_tap_subscribed;
 
-  // Footer line 1: TID (bigger, center aligned)
-  s_tid_layer = clock_tid_init(GRect(0, footer_y + FOOTER_TID_Y_ADJUST, w, FOOTER_TID_HEIGHT), window_layer);
-  text_layer_set_font(s_tid_layer, fonts_get_system_font(FONT_KEY_GOTHIC_24_BOLD));
-  text_layer_set_text_alignment(s_tid_layer, GTextAlignmentCenter);
+static void glance_timer_handler(void *context) {
+  (void)context;
+  s_glance_timer = NULL;
+  s_glance_burst = false;
+  live_tid_stop();
+  face_detail_update();
+  scheduler_wake(NULL);
+}
+
+static void glance_tap() {
+  if (!settings.glance_seconds || !s_face_layer) return;
+  uint32_t window_ms = settings.glance_seconds * 1000u;
+  if (s_glance_timer && app_timer_reschedule(s_glance_timer, window_ms)) return;
+  s_glance_timer = app_timer_register(window_ms, glance_timer_handler, NULL);
+  if (s_glance_burst) return;
+  s_glance_burst = true;
+  face_detail_update();
+  scheduler_wake(NULL);
+}
+
+// Follows the setting; switching it on or off takes effect at once
+static void glance_configure() {
+  if (s_glance_timer) app_timer_cancel(s_glance_timer);
+  s_glance_timer = NULL;
+  s_glance_burst = false;
+  face_detail_update();
+}
+
+static void tap_handler(AccelAxisType axis, int32_t direction) {
+  (void)axis;
+  (void)direction;
+  glance_tap(); // first, so a live TID burst starts on the full face
+  live_tid_tap();
+}
+
+// The tap service is subscribed only while something listens to it
+static void tap_service_configure() {
+  bool on = settings.glance_seconds > 0 || (CLOCK_WITH_TID && settings.live_tid_hz > 0);
+  if (on && !s_tap_subscribed) accel_tap_service_subscribe(tap_handler);
+  if (!on && s_tap_subscribed) accel_tap_service_unsubscribe();
+  s_tap_subscribed = on;
+}
+
+// --- Wakeup Scheduling ---
+
+// Makes every module due on the next wakeup, except those the power tier or
+// a resting glance mode hides
+static void scheduler_reset() {
+  bool resting = glance_resting();
+  for (int i = 0; i < CLOCK_COUNT; ++i) {
+    uint8_t tiers = CLOCK_MODULES[i].tiers;
+    bool hidden = (s_power_tier == POWER_CRITICAL && !(tiers & CLOCK_CRITICAL_SHOWN)) ||
+                  (resting && !(tiers & CLOCK_GLANCE_SHOWN));
+    s_next_due[i] = hidden ? SCHEDULER_NEVER : 0;
+  }
+}
+
+// First second of the minute after `now`
+static time_t scheduler_next_minute(time_t now) {
+  return now - now % 60 + 60;
+}
+
+// A module's own deadline, stretched by the power tier: economy holds the
+// hero and TID to minute boundaries, critical drops the footer entirely.
+// A resting glance mode holds what it shows to minutes and drops the rest.
+static time_t scheduler_tier_due(const ClockModule *module, time_t due, time_t now) {
+  time_t next_minute = scheduler_next_minute(now);
+  if (glance_resting()) {
+    if (!(module->tiers & CLOCK_GLANCE_SHOWN)) return SCHEDULER_NEVER;
+    if (due < next_minute) due = next_minute;
+  }
+  switch (s_power_tier) {
+    case POWER_ECONOMY:
+      return ((module->tiers & CLOCK_ECONOMY_MINUTES) && due < next_minute) ? next_minute : due;
+    case POWER_CRITICAL:
+      return (module->tiers & CLOCK_CRITICAL_SHOWN) ? due : SCHEDULER_NEVER;
+    default:
+      return due;
+  }
+}
+
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+  (void)units_changed;
+  scheduler_wake(tick_time);
+}
+
+static void wakeup_timer_handler(void *context) {
+  (void)context;
+  s_wakeup_timer = NULL;
+  scheduler_wake(NULL);
+}
+
+static void scheduler_set_tick_unit(TimeUnits unit) {
+  if (s_tick_subscribed && s_tick_unit == unit) return;
+  tick_timer_service_subscribe(unit, tick_handler);
+  s_tick_unit = unit;
+  s_tick_subscribed = true;
+}
 
-  // Footer line 2: Beat (smaller, center aligned)
-  s_beat_layer = clock_beat_init(GRect(0, footer_y + FOOTER_TID_HEIGHT + FOOTER_BEAT_Y_ADJUST, w, beat_h), window_layer);
-  text_layer_set_font(s_beat_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18));
-  text_layer_set_text_alignment(s_beat_layer, GTextAlignmentCenter);
+static void scheduler_cancel_timer() {
+  if (s_wakeup_timer) app_timer_cancel(s_wakeup_timer);
+  s_wakeup_timer = NULL;
+}
+
+// Picks the cheapest wakeup source that still meets the earliest deadline
+static void scheduler_plan(time_t now, uint16_t now_ms) {
+  time_t earliest = s_next_due[0];
+  for (int i = 1; i < CLOCK_COUNT; ++i) {
+    if (s_next_due[i] < earliest) earliest = s_next_due[i];
+  }
+
+  if (earliest <= now + 1) {
+    scheduler_cancel_timer();
+    scheduler_set_tick_unit(SECOND_UNIT);
+    return;
+  }
+  scheduler_set_tick_unit(MINUTE_UNIT);
+
+  time_t wake_at = earliest;
+  for (int i = 0; i < CLOCK_COUNT; ++i) {
+    if (s_next_due[i] > wake_at && s_next_due[i] <= earliest + SCHEDULER_COALESCE_SECONDS) {
+      wake_at = s_next_due[i];
+    }
+  }
+  time_t next_minute = scheduler_next_minute(now);
+  if (wake_at >= next_minute - SCHEDULER_COALESCE_SECONDS) {
+    scheduler_cancel_timer(); // the minute tick is close enough
+    return;
+  }
+  if (s_wakeup_timer && s_wakeup_at == wake_at) return;
+
+  scheduler_cancel_timer();
+  uint32_t delay_ms = (uint32_t)(wake_at - now) * 1000 - now_ms + SCHEDULER_TIMER_SLACK_MS;
+  s_wakeup_timer = app_timer_register(delay_ms, wakeup_timer_handler, NULL);
+  s_wakeup_at = wake_at;
+}
+
+// Runs the modules that are due, then plans the next wakeup
+static void scheduler_wake(struct tm *tick_time) {
+  PROFILE_TICK_BEGIN();
+  time_t seconds;
+  uint16_t milliseconds;
+  time_ms(&seconds, &milliseconds);
+  // Deadlines are meaningless once the clock has been set back
+  if (s_last_wake >= 0 && seconds < s_last_wake) scheduler_reset();
+  s_last_wake = seconds;
+  // Shared UTC breakdown, kept up only if a module reads it
+  if (s_clock_fields & CLOCK_TIME_UTC) time_math_utc_advance(&s_utc_now, seconds, tick_time);
 
-  // Apply color scheme to layers
+  APP_LOG(APP_LOG_LEVEL_DEBUG, "Wake! Current mode: %d", settings.target_time_mode);
+
+  // Render the modules that are due, each with the time fields it reads
+  for (int i = 0; i < CLOCK_COUNT; ++i) {
+    if (s_next_due[i] > seconds) continue;
+    const ClockModule *module = &CLOCK_MODULES[i];
+    ClockTime now = {
+      .seconds      = seconds,
+      .milliseconds = (module->fields & CLOCK_TIME_MILLIS) ? milliseconds : 0,
+      .utc          = (module->fields & CLOCK_TIME_UTC) ? &s_utc_now : NULL,
+    };
+    module->render(&now);
+    s_next_due[i] = scheduler_tier_due(module, module->next_change(&now), seconds);
+  }
+
+  scheduler_plan(seconds, milliseconds);
+  PROFILE_TICK_END();
+}
+
+static void main_window_load(Window *window) {
+  Layer *window_layer = window_get_root_layer(window);
+  GRect bounds = layer_get_bounds(window_layer);
+
+  // One custom layer draws every field; field frames are relative to it
+  s_face_layer = face_layer_create(bounds, window_layer);
+
+  // Each module lays out its own fields
+  for (int i = 0; i < CLOCK_COUNT; ++i) CLOCK_MODULES[i].init(bounds);
+
+  // Apply color scheme to the face
   apply_color_scheme();
 }
 
 static void main_window_unload(Window *window) {
   (void)window;
-  // Destroy Closest Noon layers
-  clock_closest_airport_noon_deinit(s_airport_noon_code_layer);
-  text_layer_destroy(s_airport_noon_name_layer);
-  clock_closest_airport_noon_deinit(s_airport_noon_time_layer);
-  clock_tid_deinit(s_tid_layer);
-  clock_beat_deinit(s_beat_layer);
+  for (int i = 0; i < CLOCK_COUNT; ++i) CLOCK_MODULES[i].deinit();
+  face_layer_destroy();
+  s_face_layer = NULL;
 }
 
 static void init() {
-  {
-    time_t seed_sec;
-    uint16_t seed_ms;
-    time_ms(&seed_sec, &seed_ms);
-    srand((unsigned int)(seed_sec * 1000 + seed_ms));
-  }
   // Load settings
   load_settings();
+  for (int i = 0; i < CLOCK_COUNT; ++i) s_clock_fields |= CLOCK_MODULES[i].fields;
+  apply_strip_settings();
+  PROFILER_INIT();
 
   // Create main Window element and assign to pointer
   s_main_window = window_create();
@@ -224,25 +1051,40 @@ static void init() {
   time_t seconds;
   uint16_t milliseconds;
   time_ms(&seconds, &milliseconds); 
-  // Perform initial update after loading settings
-  tick_handler(NULL, SECOND_UNIT); // Pass NULL tick_time as it's not used by our handler logic
-
-  // Register with TickTimerService to update every second
-  tick_timer_service_subscribe(SECOND_UNIT, tick_handler);
+  // Warm start: reuse the persisted pick when it is still current
+  selection_history_load(HISTORY_KEY, seconds);
+  load_selection(seconds);
+  load_schedule();
+  // Start in the tier the battery calls for, then follow it
+  power_tier_update(battery_state_service_peek());
+  battery_state_service_subscribe(battery_handler);
+  glance_configure();
+  tap_service_configure();
+  // Perform initial update after loading settings; this also subscribes to
+  // the tick service at whatever rate the modules need
+  scheduler_reset();
+  scheduler_wake(NULL); // NULL tick_time: the first wakeup always resyncs
+  update_strip_text(); // a restored pick brings its strip rows along
 
-  // Register AppMessage handlers
-  app_message_register_inbox_received(inbox_received_handler);
-  // Open AppMessage with default inbox size from Clay docs
-  AppMessageResult result = app_message_open(128, 0); // 128 inbox, 0 outbox (adjust if needed)
-  if (result == APP_MSG_OK) {
-      APP_LOG(APP_LOG_LEVEL_INFO, "AppMessage opened successfully!");
+  // AppMessage opens once the phone is there (now, or on first connection)
+  if (connection_service_peek_pebble_app_connection()) {
+    messaging_open();
   } else {
-      APP_LOG(APP_LOG_LEVEL_ERROR, "Failed to open AppMessage: %d", result);
+    connection_service_subscribe((ConnectionHandlers){ .pebble_app_connection_handler = app_connection_handler });
   }
 }
 
 static void deinit() {
   tick_timer_service_unsubscribe();
+  battery_state_service_unsubscribe();
+  if (s_tap_subscribed) accel_tap_service_unsubscribe();
+  live_tid_stop();
+  if (s_glance_timer) app_timer_cancel(s_glance_timer);
+  if (!s_messaging_open) connection_service_unsubscribe();
+  schedule_rx_release();
+  scheduler_cancel_timer();
+  save_selection();
+  selection_history_flush();
   window_destroy(s_main_window);
 }
 
@@ -255,11 +1097,7 @@ static void apply_color_scheme() {
     window_set_background_color(s_main_window, bg);
   }
 
-  if (s_airport_noon_code_layer)  text_layer_set_text_color(s_airport_noon_code_layer, fg);
-  if (s_airport_noon_name_layer)  text_layer_set_text_color(s_airport_noon_name_layer, fg);
-  if (s_airport_noon_time_layer)  text_layer_set_text_color(s_airport_noon_time_layer, fg);
-  if (s_tid_layer)               text_layer_set_text_color(s_tid_layer, fg);
-  if (s_beat_layer)              text_layer_set_text_color(s_beat_layer, fg);
+  if (s_face_layer) face_layer_set_text_color(fg);
 }
 
 int main(void) {
@@ -1,3 +1,37 @@
+// Target hours for the world strip selects; "-1" leaves a row out
+function stripHourOptions() {
+  var options = [{ label: "Off", value: "-1" }];
+  for (var h = 0; h < 24; h++) {
+    options.push({ label: (h < 10 ? "0" : "") + h + ":00", value: String(h) });
+  }
+  return options;
+}
+
+function stripTarget(n, defaultValue) {
+  return {
+    type: "select",
+    defaultValue: defaultValue,
+    label: "Strip target " + n,
+    messageKey: "stripTarget" + n,
+    options: stripHourOptions(),
+  };
+}
+
+// Battery thresholds for the power tiers; "0" never switches
+function batteryThreshold(label, messageKey, defaultValue) {
+  var options = [{ label: "Never", value: "0" }];
+  for (var p = 10; p <= 50; p += 10) {
+    options.push({ label: "At " + p + "% or less", value: String(p) });
+  }
+  return {
+    type: "select",
+    defaultValue: defaultValue,
+    label: label,
+    messageKey: messageKey,
+    options: options,
+  };
+}
+
 module.exports = [
   {
     type: "heading",
@@ -50,6 +84,84 @@ module.exports = [
       },
     ],
   },
+  {
+    type: "section",
+    items: [
+      {
+        type: "heading",
+        defaultValue: "World strip",
+      },
+      {
+        type: "toggle",
+        defaultValue: false,
+        label: "Show airports for more target times",
+        description: "A line above the footer with the airport closest to each target, picked together with the main one.",
+        messageKey: "worldStrip",
+      },
+      stripTarget(1, "9"),
+      stripTarget(2, "17"),
+      stripTarget(3, "0"),
+    ],
+  },
+  {
+    type: "section",
+    items: [
+      {
+        type: "heading",
+        defaultValue: "Battery",
+      },
+      {
+        type: "text",
+        defaultValue: "Economy updates the TID and airport time once a minute. Critical shows only the airport code and minutes. Charging always uses the full face.",
+      },
+      batteryThreshold("Economy mode", "economyBelow", "30"),
+      batteryThreshold("Critical mode", "criticalBelow", "10"),
+    ],
+  },
+  {
+    type: "section",
+    items: [
+      {
+        type: "heading",
+        defaultValue: "Live TID",
+      },
+      {
+        type: "select",
+        defaultValue: "0",
+        label: "After a wrist tap",
+        description: "Runs the TID at this rate for a few seconds, then back to once a second. Only on the full face.",
+        messageKey: "liveTid",
+        options: [
+          { label: "Off", value: "0" },
+          { label: "5 updates a second", value: "5" },
+          { label: "10 updates a second", value: "10" },
+          { label: "20 updates a second", value: "20" },
+        ],
+      },
+    ],
+  },
+  {
+    type: "section",
+    items: [
+      {
+        type: "heading",
+        defaultValue: "Glance",
+      },
+      {
+        type: "select",
+        defaultValue: "0",
+        label: "Glance mode",
+        description: "Shows only the airport and its minutes, updated once a minute. A wrist tap brings the full face back for this long.",
+        messageKey: "glanceSeconds",
+        options: [
+          { label: "Off", value: "0" },
+          { label: "10 seconds", value: "10" },
+          { label: "20 seconds", value: "20" },
+          { label: "30 seconds", value: "30" },
+        ],
+      },
+    ],
+  },
   {
     type: "submit",
     defaultValue: "Save",
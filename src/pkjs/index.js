@@ -1,3 +1,42 @@
 var Clay = require("pebble-clay");
 var clayConfig = require("./config");
 var clay = new Clay(clayConfig);
+var schedule = require("./schedule");
+var profile = require("./profile");
+
+// --- Phone schedule (requested by the watch when its copy runs low) ---
+function sendSchedule(requestBytes) {
+  var request = schedule.decodeRequest(requestBytes);
+  var bytes = request && schedule.buildSchedule(request, Date.now() / 1000);
+  if (!bytes) {
+    console.log("tidface schedule: cannot serve this watch, it keeps its own table");
+    return;
+  }
+  var chunks = schedule.splitSchedule(bytes);
+  function sendChunk(i) {
+    if (i === chunks.length) {
+      console.log("tidface schedule: sent " + request.slotCount + " slots in " + chunks.length + " messages");
+      return;
+    }
+    Pebble.sendAppMessage(chunks[i], function () { sendChunk(i + 1); }, function () {
+      console.log("tidface schedule: send failed, the watch will ask again");
+    });
+  }
+  sendChunk(0);
+}
+
+Pebble.addEventListener("appmessage", function (e) {
+  if (e.payload && e.payload.scheduleRequest) {
+    sendSchedule(e.payload.scheduleRequest);
+    return;
+  }
+  // Profiler summaries (watch built with ENABLE_PROFILER=1)
+  var bytes = e.payload && e.payload.profile;
+  if (!bytes) return;
+  var summary = profile.decodeProfile(bytes);
+  if (summary) {
+    console.log("tidface profile " + JSON.stringify(summary));
+  } else {
+    console.log("tidface profile: unknown summary version " + bytes[0]);
+  }
+});
@@ -0,0 +1,42 @@
+// --- Profiler summaries (watch built with ENABLE_PROFILER=1) ---
+// Layout mirrors ProfileSummary in src/c/profiler.h (packed, little-endian).
+// `redraws` is indexed by ProfileField, the same in every build: a face
+// without TID leaves its entry at 0 rather than shifting .beat into it.
+var PROFILE_FIELD_NAMES = ["code", "name", "time", "strip", "tid", "beat"]; // ProfileField order
+
+function decodeProfile(bytes) {
+  var pos = 0;
+  function u8() { return bytes[pos++]; }
+  function u16() { var v = bytes[pos] | (bytes[pos + 1] << 8); pos += 2; return v; }
+  function u32() { var v = u16(); return v + u16() * 65536; }
+
+  var summary = {
+    version: u8(),
+    fieldCount: u8(),
+    windowMinutes: u16(),
+    ticks: u32(),
+    tickTotalMs: u32(),
+    tickMaxMs: u16(),
+    reevalCount: u16(),
+    reevalMaxMs: u16(),
+    frames: u16(),
+    heapFreeMin: u32(),
+    heapFreeMax: u32(),
+    heapUsedMax: u32(),
+    messageHeap: u16(),
+    messageReclaimed: u16(),
+    redraws: {}
+  };
+  if (summary.version !== 3) return null;
+  for (var i = 0; i < summary.fieldCount; i++) {
+    var count = u16();
+    if (count > 0) summary.redraws[PROFILE_FIELD_NAMES[i] || ("field" + i)] = count;
+  }
+  summary.tickAvgMs = summary.ticks ? summary.tickTotalMs / summary.ticks : 0;
+  return summary;
+}
+
+module.exports = {
+  PROFILE_FIELD_NAMES: PROFILE_FIELD_NAMES,
+  decodeProfile: decodeProfile
+};
@@ -0,0 +1,131 @@
+// --- Phone schedule ---
+// Hero picks for every :00/:15/:30 slot of the next hours, computed with the
+// phone's tz database (Intl) and sent to the watch as one byte array, split
+// over a few messages.  The pick mirrors _airport_pick_new() in
+// src/c/clock_closest_airport_noon.h: buckets tied on the closest local time
+// at or past the target, in table order, one of them chosen by the same
+// splitmix32 hash of the slot instant.
+// The watch picks the airport within the bucket itself.
+var bucketTables = require("./airport_buckets.json").tables;
+
+var SCHEDULE_VERSION = 1;       // AIRPORT_SCHEDULE_VERSION
+var SLOTS_PER_HOUR = 3;         // :00, :15, :30
+var SLOTS_MAX = 48 * SLOTS_PER_HOUR;
+var SLOT_NONE = 0xff;
+var SLOT_SECONDS = 900;
+var DAY_SECONDS = 86400;
+var CHUNK_BYTES = 100;          // SCHEDULE_CHUNK_BYTES in src/c/watchface.c
+
+// AirportScheduleRequest, packed little-endian
+function decodeRequest(bytes) {
+  if (!bytes || bytes.length < 8 || bytes[0] !== SCHEDULE_VERSION) return null;
+  return {
+    targetQuarters: bytes[1],
+    slotCount: Math.min(bytes[2], SLOTS_MAX),
+    bucketCount: bytes[3],
+    checksum: (bytes[4] | (bytes[5] << 8) | (bytes[6] << 16) | (bytes[7] << 24)) >>> 0
+  };
+}
+
+function findTable(request) {
+  for (var i = 0; i < bucketTables.length; i++) {
+    var table = bucketTables[i];
+    if (table.checksum === request.checksum && table.zones.length === request.bucketCount) return table;
+  }
+  return null;
+}
+
+// UTC offset of `zone` at `utcSeconds`, in 0.25h units
+var formatters = {};
+function offsetQuarters(zone, utcSeconds) {
+  var format = formatters[zone];
+  if (!format) {
+    format = formatters[zone] = new Intl.DateTimeFormat("en-US", {
+      timeZone: zone, hourCycle: "h23",
+      year: "numeric", month: "numeric", day: "numeric",
+      hour: "numeric", minute: "numeric", second: "numeric"
+    });
+  }
+  var parts = {};
+  format.formatToParts(new Date(utcSeconds * 1000)).forEach(function (p) { parts[p.type] = +p.value; });
+  var local = Date.UTC(parts.year, parts.month - 1, parts.day, parts.hour % 24, parts.minute, parts.second) / 1000;
+  return Math.round((local - utcSeconds) / SLOT_SECONDS);
+}
+
+function splitmix32(x) {
+  x = (x + 0x9e3779b9) >>> 0;
+  x = Math.imul(x ^ (x >>> 16), 0x85ebca6b) >>> 0;
+  x = Math.imul(x ^ (x >>> 13), 0xc2b2ae35) >>> 0;
+  return (x ^ (x >>> 16)) >>> 0;
+}
+
+// _airport_pick() for the hero's bucket stream (stream 0)
+function pickIndex(slotTime, count) {
+  if (count <= 1) return 0;
+  return Math.floor(splitmix32(slotTime >>> 0) * count / 4294967296);
+}
+
+function pickSlot(zones, slotTime, targetSeconds) {
+  var utcSod = ((slotTime % DAY_SECONDS) + DAY_SECONDS) % DAY_SECONDS;
+  var best = DAY_SECONDS;
+  var winners = [];
+  var offsets = [];
+  for (var i = 0; i < zones.length; i++) {
+    offsets[i] = offsetQuarters(zones[i], slotTime);
+    var day = ((offsets[i] % 96) + 96) % 96;
+    var local = (utcSod + day * SLOT_SECONDS) % DAY_SECONDS;
+    if (local < targetSeconds) continue;
+    if (local < best) {
+      best = local;
+      winners = [];
+    }
+    if (local === best) winners.push(i);
+  }
+  if (!winners.length) return [SLOT_NONE, 0];
+  var bucket = winners[pickIndex(slotTime, winners.length)];
+  return [bucket, offsets[bucket] & 0xff];
+}
+
+// AirportSchedule, packed little-endian; null if this phone cannot serve the
+// request (unknown data, or no Intl time zone support)
+function buildSchedule(request, nowSeconds) {
+  var table = findTable(request);
+  if (!table) return null;
+  var first = Math.floor(nowSeconds / 3600) * 3600;
+  var count = request.slotCount;
+  var bytes = [SCHEDULE_VERSION, request.targetQuarters, count, table.zones.length,
+               table.checksum & 0xff, (table.checksum >>> 8) & 0xff,
+               (table.checksum >>> 16) & 0xff, table.checksum >>> 24,
+               first & 0xff, (first >>> 8) & 0xff, (first >>> 16) & 0xff, (first >>> 24) & 0xff];
+  try {
+    for (var s = 0; s < count; s++) {
+      var slotTime = first + Math.floor(s / SLOTS_PER_HOUR) * 3600 + (s % SLOTS_PER_HOUR) * SLOT_SECONDS;
+      var entry = pickSlot(table.zones, slotTime, request.targetQuarters * SLOT_SECONDS);
+      bytes.push(entry[0], entry[1]);
+    }
+  } catch (e) {
+    console.log("tidface schedule: " + e);
+    return null;
+  }
+  return bytes;
+}
+
+// AppMessage payloads carrying `bytes` in order; the watch keeps its inbox
+// small and reassembles the schedule from the offsets
+function splitSchedule(bytes) {
+  var chunks = [];
+  for (var offset = 0; offset < bytes.length; offset += CHUNK_BYTES) {
+    chunks.push({
+      schedule: bytes.slice(offset, offset + CHUNK_BYTES),
+      scheduleOffset: offset,
+      scheduleLength: bytes.length
+    });
+  }
+  return chunks;
+}
+
+module.exports = {
+  decodeRequest: decodeRequest,
+  buildSchedule: buildSchedule,
+  splitSchedule: splitSchedule
+};
@@ -0,0 +1,156 @@
+#ifndef HOST_PEBBLE_H
+#define HOST_PEBBLE_H
+
+// Minimal host-side stand-in for the Pebble SDK header, just enough to build
+// the clock modules and the face layer unchanged with a desktop compiler.
+// Graphics and layers are no-ops that only count invalidations; the clock is
+// driven by the simulator through shim_set_time(); persistent storage is an
+// in-memory key/value table; resources are files named by their
+// SHIM_RESOURCE_* path.  See pebble_shim.c.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// --- Geometry & colours ---
+typedef struct { int16_t x, y; } GPoint;
+typedef struct { int16_t w, h; } GSize;
+typedef struct { GPoint origin; GSize size; } GRect;
+#define GPoint(x, y)       ((GPoint){ (x), (y) })
+#define GSize(w, h)        ((GSize){ (w), (h) })
+#define GRect(x, y, w, h)  ((GRect){ { (x), (y) }, { (w), (h) } })
+#define GRectZero          GRect(0, 0, 0, 0)
+
+typedef union { uint8_t argb; } GColor8;
+typedef GColor8 GColor;
+#define GColorBlack  ((GColor8){ 0xC0 })
+#define GColorWhite  ((GColor8){ 0xFF })
+#define GColorClear  ((GColor8){ 0x00 })
+
+typedef enum { GTextAlignmentLeft, GTextAlignmentCenter, GTextAlignmentRight } GTextAlignment;
+typedef enum {
+    GTextOverflowModeWordWrap,
+    GTextOverflowModeTrailingEllipsis,
+    GTextOverflowModeFill
+} GTextOverflowMode;
+
+// --- Opaque UI types ---
+typedef struct Layer Layer;
+typedef struct Window Window;
+typedef struct TextLayer TextLayer;
+typedef struct GContext GContext;
+typedef struct GTextAttributes GTextAttributes;
+typedef const void *GFont;
+typedef void (*LayerUpdateProc)(Layer *layer, GContext *ctx);
+
+// --- Fonts ---
+#define FONT_KEY_GOTHIC_14            "GOTHIC_14"
+#define FONT_KEY_GOTHIC_18            "GOTHIC_18"
+#define FONT_KEY_GOTHIC_18_BOLD       "GOTHIC_18_BOLD"
+#define FONT_KEY_GOTHIC_24            "GOTHIC_24"
+#define FONT_KEY_GOTHIC_24_BOLD       "GOTHIC_24_BOLD"
+#define FONT_KEY_GOTHIC_28_BOLD       "GOTHIC_28_BOLD"
+#define FONT_KEY_LECO_42_NUMBERS      "LECO_42_NUMBERS"
+GFont fonts_get_system_font(const char *font_key);
+
+// --- Layers & drawing ---
+Layer* layer_create(GRect frame);
+void   layer_destroy(Layer *layer);
+void   layer_add_child(Layer *parent, Layer *child);
+void   layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc);
+void   layer_mark_dirty(Layer *layer);
+GRect  layer_get_bounds(const Layer *layer);
+void   graphics_context_set_text_color(GContext *ctx, GColor color);
+void   graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box,
+                          GTextOverflowMode overflow, GTextAlignment alignment,
+                          GTextAttributes *attributes);
+
+// --- Bitmaps & compositing ---
+// There is no frame buffer on the host: capture returns NULL, so glyph caches
+// fall back to plain text.
+typedef struct GBitmap GBitmap;
+typedef enum {
+    GBitmapFormat1Bit = 0,
+    GBitmapFormat8Bit,
+    GBitmapFormat1BitPalette,
+    GBitmapFormat2BitPalette,
+    GBitmapFormat4BitPalette,
+    GBitmapFormat8BitCircular,
+} GBitmapFormat;
+typedef struct { uint8_t *data; int16_t min_x, max_x; } GBitmapDataRowInfo;
+typedef enum { GCompOpAssign, GCompOpAssignInverted, GCompOpOr, GCompOpAnd, GCompOpClear, GCompOpSet } GCompOp;
+typedef enum { GCornerNone = 0 } GCornerMask;
+bool     gcolor_equal(GColor a, GColor b);
+GBitmap* gbitmap_create_blank(GSize size, GBitmapFormat format);
+GBitmap* gbitmap_create_blank_with_palette(GSize size, GBitmapFormat format, GColor *palette, bool free_on_destroy);
+GBitmap* gbitmap_create_as_sub_bitmap(const GBitmap *base, GRect sub_rect);
+void     gbitmap_destroy(GBitmap *bitmap);
+uint8_t* gbitmap_get_data(const GBitmap *bitmap);
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap);
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap);
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y);
+GBitmap* graphics_capture_frame_buffer(GContext *ctx);
+bool     graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer);
+void     graphics_context_set_fill_color(GContext *ctx, GColor color);
+void     graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode);
+void     graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask);
+void     graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect);
+GSize    graphics_text_layout_get_content_size(const char *text, GFont font, GRect box,
+                                               GTextOverflowMode overflow, GTextAlignment alignment);
+
+// --- TextLayer ---
+TextLayer* text_layer_create(GRect frame);
+void   text_layer_destroy(TextLayer *text_layer);
+Layer* text_layer_get_layer(TextLayer *text_layer);
+void   text_layer_set_text(TextLayer *text_layer, const char *text);
+void   text_layer_set_font(TextLayer *text_layer, GFont font);
+void   text_layer_set_text_color(TextLayer *text_layer, GColor color);
+void   text_layer_set_background_color(TextLayer *text_layer, GColor color);
+void   text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment);
+
+// --- Time ---
+typedef enum {
+    SECOND_UNIT = 1 << 0,
+    MINUTE_UNIT = 1 << 1,
+    HOUR_UNIT   = 1 << 2,
+    DAY_UNIT    = 1 << 3,
+} TimeUnits;
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms);
+
+// --- Persistent storage ---
+#define PERSIST_DATA_MAX_LENGTH 256
+#define E_DOES_NOT_EXIST (-4)
+bool    persist_exists(uint32_t key);
+int     persist_get_size(uint32_t key);
+int     persist_read_data(uint32_t key, void *buffer, size_t buffer_size);
+int     persist_write_data(uint32_t key, const void *data, size_t size);
+int32_t persist_read_int(uint32_t key);
+int     persist_write_int(uint32_t key, int32_t value);
+int     persist_delete(uint32_t key);
+
+// --- Resources ---
+// RESOURCE_ID_* are indices into the shim's file table
+typedef const void *ResHandle;
+#define RESOURCE_ID_AIRPORT_DATA 1
+ResHandle resource_get_handle(uint32_t resource_id);
+size_t    resource_size(ResHandle h);
+size_t    resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes);
+
+// --- Logging ---
+#define APP_LOG_LEVEL_ERROR   1
+#define APP_LOG_LEVEL_WARNING 50
+#define APP_LOG_LEVEL_INFO    100
+#define APP_LOG_LEVEL_DEBUG   200
+#define APP_LOG(level, fmt, ...) ((void)(level))
+
+// --- Simulator hooks (not part of the SDK) ---
+void     shim_set_time(time_t seconds, uint16_t milliseconds);
+uint32_t shim_dirty_count(void);
+void     shim_persist_reset(void);
+uint32_t shim_persist_writes(void);
+uint32_t shim_resource_reads(void);
+
+#endif // HOST_PEBBLE_H
@@ -0,0 +1,300 @@
+#include <pebble.h>
+#include <stdlib.h>
+
+// --- Simulated clock ---
+static time_t   s_now_seconds;
+static uint16_t s_now_ms;
+
+void shim_set_time(time_t seconds, uint16_t milliseconds) {
+    s_now_seconds = seconds;
+    s_now_ms = milliseconds;
+}
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms) {
+    if (tloc) *tloc = s_now_seconds;
+    if (out_ms) *out_ms = s_now_ms;
+    return s_now_ms;
+}
+
+// --- Layers: one dummy object, only invalidations are counted ---
+struct Layer { GRect frame; LayerUpdateProc update_proc; };
+struct TextLayer { Layer layer; };
+
+static uint32_t s_dirty_count;
+
+uint32_t shim_dirty_count(void) {
+    return s_dirty_count;
+}
+
+GFont fonts_get_system_font(const char *font_key) {
+    return font_key;
+}
+
+Layer* layer_create(GRect frame) {
+    Layer *layer = calloc(1, sizeof(Layer));
+    if (layer) layer->frame = frame;
+    return layer;
+}
+
+void layer_destroy(Layer *layer) {
+    free(layer);
+}
+
+void layer_add_child(Layer *parent, Layer *child) {
+    (void)parent;
+    (void)child;
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+    if (layer) layer->update_proc = update_proc;
+}
+
+void layer_mark_dirty(Layer *layer) {
+    (void)layer;
+    s_dirty_count++;
+}
+
+GRect layer_get_bounds(const Layer *layer) {
+    return layer ? GRect(0, 0, layer->frame.size.w, layer->frame.size.h) : GRectZero;
+}
+
+void graphics_context_set_text_color(GContext *ctx, GColor color) {
+    (void)ctx;
+    (void)color;
+}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box,
+                        GTextOverflowMode overflow, GTextAlignment alignment,
+                        GTextAttributes *attributes) {
+    (void)ctx; (void)text; (void)font; (void)box;
+    (void)overflow; (void)alignment; (void)attributes;
+}
+
+// --- Bitmaps: plain heap buffers, never drawn ---
+struct GBitmap {
+    GBitmapFormat format;
+    uint16_t      row_bytes;
+    uint8_t      *data;
+    bool          owns_data;
+};
+
+bool gcolor_equal(GColor a, GColor b) {
+    return a.argb == b.argb;
+}
+
+GBitmap* gbitmap_create_blank(GSize size, GBitmapFormat format) {
+    GBitmap *bitmap = calloc(1, sizeof(GBitmap));
+    if (!bitmap) return NULL;
+    bitmap->format = format;
+    bitmap->row_bytes = (format == GBitmapFormat8Bit) ? (uint16_t)size.w : (uint16_t)((size.w + 7) / 8);
+    bitmap->data = calloc((size_t)bitmap->row_bytes * (size_t)size.h + 1, 1);
+    bitmap->owns_data = true;
+    if (!bitmap->data) {
+        free(bitmap);
+        return NULL;
+    }
+    return bitmap;
+}
+
+GBitmap* gbitmap_create_blank_with_palette(GSize size, GBitmapFormat format, GColor *palette, bool free_on_destroy) {
+    (void)palette; (void)free_on_destroy;
+    return gbitmap_create_blank(size, format);
+}
+
+GBitmap* gbitmap_create_as_sub_bitmap(const GBitmap *base, GRect sub_rect) {
+    (void)sub_rect;
+    GBitmap *bitmap = calloc(1, sizeof(GBitmap));
+    if (bitmap && base) *bitmap = (GBitmap){ base->format, base->row_bytes, base->data, false };
+    return bitmap;
+}
+
+void gbitmap_destroy(GBitmap *bitmap) {
+    if (bitmap && bitmap->owns_data) free(bitmap->data);
+    free(bitmap);
+}
+
+uint8_t* gbitmap_get_data(const GBitmap *bitmap) { return bitmap ? bitmap->data : NULL; }
+uint16_t gbitmap_get_bytes_per_row(const GBitmap *bitmap) { return bitmap ? bitmap->row_bytes : 0; }
+GBitmapFormat gbitmap_get_format(const GBitmap *bitmap) { return bitmap ? bitmap->format : GBitmapFormat1Bit; }
+
+GBitmapDataRowInfo gbitmap_get_data_row_info(const GBitmap *bitmap, uint16_t y) {
+    GBitmapDataRowInfo info = { NULL, 0, -1 };
+    if (bitmap) info.data = bitmap->data + (size_t)y * bitmap->row_bytes;
+    return info;
+}
+
+GBitmap* graphics_capture_frame_buffer(GContext *ctx) { (void)ctx; return NULL; }
+bool graphics_release_frame_buffer(GContext *ctx, GBitmap *buffer) { (void)ctx; (void)buffer; return true; }
+void graphics_context_set_fill_color(GContext *ctx, GColor color) { (void)ctx; (void)color; }
+void graphics_context_set_compositing_mode(GContext *ctx, GCompOp mode) { (void)ctx; (void)mode; }
+
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {
+    (void)ctx; (void)rect; (void)corner_radius; (void)corner_mask;
+}
+
+void graphics_draw_bitmap_in_rect(GContext *ctx, const GBitmap *bitmap, GRect rect) {
+    (void)ctx; (void)bitmap; (void)rect;
+}
+
+GSize graphics_text_layout_get_content_size(const char *text, GFont font, GRect box,
+                                            GTextOverflowMode overflow, GTextAlignment alignment) {
+    (void)font; (void)overflow; (void)alignment;
+    return GSize((int16_t)(strlen(text) * 10 < (size_t)box.size.w ? strlen(text) * 10 : (size_t)box.size.w), box.size.h);
+}
+
+TextLayer* text_layer_create(GRect frame) {
+    TextLayer *text_layer = calloc(1, sizeof(TextLayer));
+    if (text_layer) text_layer->layer.frame = frame;
+    return text_layer;
+}
+
+void text_layer_destroy(TextLayer *text_layer) {
+    free(text_layer);
+}
+
+Layer* text_layer_get_layer(TextLayer *text_layer) {
+    return text_layer ? &text_layer->layer : NULL;
+}
+
+void text_layer_set_text(TextLayer *text_layer, const char *text) {
+    (void)text;
+    layer_mark_dirty(text_layer_get_layer(text_layer));
+}
+
+void text_layer_set_font(TextLayer *text_layer, GFont font) { (void)text_layer; (void)font; }
+void text_layer_set_text_color(TextLayer *text_layer, GColor color) { (void)text_layer; (void)color; }
+void text_layer_set_background_color(TextLayer *text_layer, GColor color) { (void)text_layer; (void)color; }
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment alignment) { (void)text_layer; (void)alignment; }
+
+// --- Persistent storage: small in-memory table ---
+#define SHIM_PERSIST_SLOTS 16
+
+typedef struct {
+    bool     used;
+    uint32_t key;
+    size_t   size;
+    uint8_t  data[PERSIST_DATA_MAX_LENGTH];
+} PersistSlot;
+
+static PersistSlot s_persist[SHIM_PERSIST_SLOTS];
+static uint32_t    s_persist_writes;
+
+void shim_persist_reset(void) {
+    memset(s_persist, 0, sizeof(s_persist));
+}
+
+uint32_t shim_persist_writes(void) {
+    return s_persist_writes;
+}
+
+static PersistSlot* persist_find(uint32_t key) {
+    for (int i = 0; i < SHIM_PERSIST_SLOTS; ++i) {
+        if (s_persist[i].used && s_persist[i].key == key) return &s_persist[i];
+    }
+    return NULL;
+}
+
+bool persist_exists(uint32_t key) {
+    return persist_find(key) != NULL;
+}
+
+int persist_get_size(uint32_t key) {
+    PersistSlot *slot = persist_find(key);
+    return slot ? (int)slot->size : E_DOES_NOT_EXIST;
+}
+
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size) {
+    PersistSlot *slot = persist_find(key);
+    if (!slot) return E_DOES_NOT_EXIST;
+    size_t n = slot->size < buffer_size ? slot->size : buffer_size;
+    memcpy(buffer, slot->data, n);
+    return (int)n;
+}
+
+int persist_write_data(uint32_t key, const void *data, size_t size) {
+    if (size > PERSIST_DATA_MAX_LENGTH) size = PERSIST_DATA_MAX_LENGTH;
+    PersistSlot *slot = persist_find(key);
+    for (int i = 0; !slot && i < SHIM_PERSIST_SLOTS; ++i) {
+        if (!s_persist[i].used) slot = &s_persist[i];
+    }
+    if (!slot) return -1;
+    s_persist_writes++;
+    slot->used = true;
+    slot->key = key;
+    slot->size = size;
+    memcpy(slot->data, data, size);
+    return (int)size;
+}
+
+int32_t persist_read_int(uint32_t key) {
+    int32_t value = 0;
+    persist_read_data(key, &value, sizeof(value));
+    return value;
+}
+
+int persist_write_int(uint32_t key, int32_t value) {
+    return persist_write_data(key, &value, sizeof(value));
+}
+
+int persist_delete(uint32_t key) {
+    PersistSlot *slot = persist_find(key);
+    if (!slot) return E_DOES_NOT_EXIST;
+    slot->used = false;
+    return 0;
+}
+
+// --- Resources: whole files read once, then served from memory ---
+#ifndef SHIM_RESOURCE_AIRPORT_DATA
+#define SHIM_RESOURCE_AIRPORT_DATA "../../resources/data/airport_data.bin"
+#endif
+
+typedef struct {
+    const char *path;
+    uint8_t    *data;
+    size_t      size;
+    bool        loaded;
+} ShimResource;
+
+static ShimResource s_resources[] = {
+    { NULL, NULL, 0, false },                        // 0: no such resource
+    { SHIM_RESOURCE_AIRPORT_DATA, NULL, 0, false },  // RESOURCE_ID_AIRPORT_DATA
+};
+static uint32_t s_resource_reads;
+
+uint32_t shim_resource_reads(void) {
+    return s_resource_reads;
+}
+
+ResHandle resource_get_handle(uint32_t resource_id) {
+    if (resource_id == 0 || resource_id >= sizeof(s_resources) / sizeof(s_resources[0])) return NULL;
+    ShimResource *res = &s_resources[resource_id];
+    if (!res->loaded) {
+        res->loaded = true;
+        FILE *f = fopen(res->path, "rb");
+        if (!f) {
+            fprintf(stderr, "cannot open resource %s\n", res->path);
+            return NULL;
+        }
+        fseek(f, 0, SEEK_END);
+        long size = ftell(f);
+        fseek(f, 0, SEEK_SET);
+        res->data = size > 0 ? malloc((size_t)size) : NULL;
+        if (res->data && fread(res->data, 1, (size_t)size, f) == (size_t)size) res->size = (size_t)size;
+        fclose(f);
+    }
+    return res->size ? res : NULL;
+}
+
+size_t resource_size(ResHandle h) {
+    return h ? ((const ShimResource *)h)->size : 0;
+}
+
+size_t resource_load_byte_range(ResHandle h, uint32_t start_offset, uint8_t *buffer, size_t num_bytes) {
+    if (!h) return 0;
+    const ShimResource *res = h;
+    s_resource_reads++;
+    if (start_offset >= res->size) return 0;
+    if (num_bytes > res->size - start_offset) num_bytes = res->size - start_offset;
+    memcpy(buffer, res->data + start_offset, num_bytes);
+    return num_bytes;
+}
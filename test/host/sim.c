@@ -0,0 +1,511 @@
+// Host-native simulation and benchmark for the clock modules.
+//
+// Replays a full year of one-second ticks through the same calls as
+// watchface.c's scheduler_wake, with the modules compiled unchanged against the
+// pebble.h shim in this directory, and reports:
+//   • ns per tick, split into plain ticks and re-evaluation ticks
+//   • face_text_set_text() calls and actual invalidations per hour
+//   • with --reference, every 15-minute pick checked against the exact
+//     per-bucket offsets exported by scripts/generateExpectedTransitions.ts
+//     (Luxon): the pick must show its zone's true offset and be one of the
+//     buckets whose local time is at or just past the target.  The world
+//     strip rows (--strip, 09:00/17:00/00:00 by default) are checked the
+//     same way.
+//   • the first 48h of hero picks replayed from a phone schedule built from
+//     them, which must reproduce every pick
+//   • every pick journaled in the selection history, which must read back
+//     the newest picks, before and after a reload from persistent storage,
+//     and its persist writes per day
+//   • wakeups per hour (seconds in which any module was due)
+//   • with --glance, watchface.c's glance mode: the hero on minutes and the
+//     footer off, except for a window of that many seconds after a wrist tap
+//     every GLANCE_TAP_PERIOD seconds.  Picks are checked as above, the
+//     airport code must not change outside the :00/:15/:30 slots, and the
+//     TID and .beat must be back on the first tick after every tap.
+//
+// Usage: sim [--reference expected_offsets_YYYY.txt] [--year YYYY]
+//            [--target SECONDS]... [--strip SECONDS]... [--days N]
+//            [--glance SECONDS]
+
+#include <pebble.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "face_layer.h"
+#include "clock_beat.h"
+#include "clock_tid.h"
+#include "clock_closest_airport_noon.h"
+#include "selection_history.h"
+
+// --- face_text_set_text()/_set_tail() counters (linked with -Wl,--wrap) ---
+bool __real_face_text_set_text(FaceText *text, const char *str);
+bool __real_face_text_set_tail(FaceText *text, const char *str, int from);
+
+static uint64_t s_set_text_calls;
+static uint64_t s_set_text_changes;
+static FaceText *s_code_field;    // airport code, watched for off-slot changes
+static bool      s_in_eval_slot;  // the current tick is a :00/:15/:30 slot
+static uint64_t  s_code_offslot;  // code changes outside the slots
+
+bool __wrap_face_text_set_text(FaceText *text, const char *str) {
+    s_set_text_calls++;
+    bool changed = __real_face_text_set_text(text, str);
+    if (changed) s_set_text_changes++;
+    if (changed && text == s_code_field && !s_in_eval_slot) s_code_offslot++;
+    return changed;
+}
+
+bool __wrap_face_text_set_tail(FaceText *text, const char *str, int from) {
+    s_set_text_calls++;
+    bool changed = __real_face_text_set_tail(text, str, from);
+    if (changed) s_set_text_changes++;
+    return changed;
+}
+
+// --- Reference offsets ---
+#define REF_MAX_CHANGES 8
+
+typedef struct {
+    char    zone[48];
+    int32_t initial;                    // offset at year start, seconds
+    int     change_count;
+    int64_t change_utc[REF_MAX_CHANGES];
+    int32_t change_offset[REF_MAX_CHANGES];
+} RefBucket;
+
+static RefBucket s_ref[TZ_LIST_COUNT];
+static int       s_ref_year;
+
+static bool load_reference(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot open reference %s\n", path);
+        return false;
+    }
+    char line[1024];
+    int buckets = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (sscanf(line, "year %d", &s_ref_year) == 1) continue;
+
+        char *p = line;
+        int idx, n;
+        RefBucket tmp = { 0 };
+        if (sscanf(p, "%d %47s %d%n", &idx, tmp.zone, &tmp.initial, &n) != 3) continue;
+        p += n;
+        long long utc;
+        int off;
+        while (tmp.change_count < REF_MAX_CHANGES && sscanf(p, "%lld %d%n", &utc, &off, &n) == 2) {
+            tmp.change_utc[tmp.change_count] = utc;
+            tmp.change_offset[tmp.change_count] = off;
+            tmp.change_count++;
+            p += n;
+        }
+        if (idx < 0 || idx >= (int)TZ_LIST_COUNT) {
+            fprintf(stderr, "reference bucket %d out of range\n", idx);
+            fclose(f);
+            return false;
+        }
+        s_ref[idx] = tmp;
+        buckets++;
+    }
+    fclose(f);
+    if (buckets != (int)TZ_LIST_COUNT || s_ref_year == 0) {
+        fprintf(stderr, "reference has %d buckets (table has %d), year %d\n",
+                buckets, (int)TZ_LIST_COUNT, s_ref_year);
+        return false;
+    }
+    return true;
+}
+
+static int32_t ref_offset(int bucket, time_t t) {
+    const RefBucket *b = &s_ref[bucket];
+    int32_t off = b->initial;
+    for (int i = 0; i < b->change_count && b->change_utc[i] <= t; ++i) off = b->change_offset[i];
+    return off;
+}
+
+// --- Helpers ---
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static time_t year_start(int year) {
+    // Days from 1970-01-01 to Jan 1st of `year` (proleptic Gregorian)
+    long days = 0;
+    for (int y = 1970; y < year; ++y) {
+        days += ((y % 4 == 0 && y % 100 != 0) || y % 400 == 0) ? 366 : 365;
+    }
+    return (time_t)days * 86400;
+}
+
+static bool is_eval_slot(int32_t sod) {
+    return sod % SLOT_SECONDS == 0 && (sod / SLOT_SECONDS) % 4 != 3;
+}
+
+static void format_utc(time_t t, char *buf, size_t len) {
+    struct tm tm;
+    gmtime_r(&t, &tm);
+    strftime(buf, len, "%Y-%m-%d %H:%M:%S", &tm);
+}
+
+// Checks a pick against the reference; returns true if it matches
+static bool check_pick(time_t t, long target, int bucket, int offset_quarters,
+                       const char *code, int *reported) {
+    int32_t sod = time_math_utc_sod(t);
+    long best = LONG_MAX;
+    for (int i = 0; i < (int)TZ_LIST_COUNT; ++i) {
+        long local = time_math_wrap_sod(sod + ref_offset(i, t));
+        if (local >= target && local - target < best) best = local - target;
+    }
+
+    const char *problem = NULL;
+    int32_t true_off = 0;
+    long delta = -1;
+    if (bucket < 0) {
+        if (best != LONG_MAX) problem = "no pick";
+    } else {
+        true_off = ref_offset(bucket, t);
+        delta = time_math_wrap_sod(sod + true_off) - target;
+        if (offset_quarters * SLOT_SECONDS != true_off) problem = "wrong offset";
+        else if (delta != best) problem = "not closest";
+    }
+    if (!problem) return true;
+
+    if ((*reported)++ < 10) {
+        char when[32];
+        format_utc(t, when, sizeof(when));
+        printf("  MISMATCH %s UTC (%s, target %lds): %s %s shows %+dq, reference %+ds, delta %lds, best %lds\n",
+               when, problem, target, code, bucket >= 0 ? s_ref[bucket].zone : "-",
+               offset_quarters, (int)true_off, delta, best);
+    }
+    return false;
+}
+
+#define SELECTION_SIM_KEY 2  // same key as watchface.c's SELECTION_KEY
+
+// Round-trips the pick through persistent storage like a warm start would
+static bool check_warm_start(time_t t, long target) {
+    AirportSelection sel, back;
+    if (!clock_closest_airport_noon_get_selection(&sel)) return false;
+    persist_write_data(SELECTION_SIM_KEY, &sel, sizeof(sel));
+    if (persist_read_data(SELECTION_SIM_KEY, &back, sizeof(back)) != (int)sizeof(back)) return false;
+    int bucket = s_selected_bucket, name = s_selected_name_index, off = s_selected_offset_quarters;
+    char strip[AIRPORT_STRIP_MAX][4];
+    memcpy(strip, s_strip_code, sizeof(strip));
+    if (!clock_closest_airport_noon_restore_selection(&back, t, target)) return false;
+    return s_selected_bucket == bucket && s_selected_name_index == name &&
+           s_selected_offset_quarters == off && memcmp(strip, s_strip_code, sizeof(strip)) == 0;
+}
+
+// --- Selection history ---
+#define HISTORY_SIM_KEY 5  // same key as watchface.c's HISTORY_KEY
+
+// Journals the current pick like watchface.c's record_selection(); false if
+// the newest entry does not read back as that pick (made in this slot, or
+// earlier if the airport was already shown)
+static bool history_record(time_t t) {
+    AirportSelection sel;
+    if (!clock_closest_airport_noon_get_selection(&sel)) return false;
+    selection_history_append(sel.eval_time, &sel.pick);
+    selection_history_flush_if_due(t);
+    SelectionHistoryEntry e;
+    return selection_history_get(0, &e) && e.bucket == sel.pick.bucket && e.name_index == sel.pick.name_index &&
+           e.slot_utc <= sel.eval_time && e.slot_utc > sel.eval_time - SELECTION_HISTORY_SLOT_SECONDS * UINT8_MAX;
+}
+
+// Flushes, reloads and compares every entry with what was held in RAM
+static uint64_t history_reload_mismatches(time_t t) {
+    static SelectionHistoryEntry before[SELECTION_HISTORY_MAX];
+    int count = selection_history_count();
+    for (int i = 0; i < count; ++i) selection_history_get(i, &before[i]);
+    selection_history_flush();
+    selection_history_load(HISTORY_SIM_KEY, t);
+    uint64_t mismatches = selection_history_count() != count;
+    for (int i = 0; i < count && !mismatches; ++i) {
+        SelectionHistoryEntry e;
+        mismatches += !selection_history_get(i, &e) || e.slot_utc != before[i].slot_utc ||
+                      e.bucket != before[i].bucket || e.name_index != before[i].name_index;
+    }
+    return mismatches;
+}
+
+// --- Phone schedule replay ---
+// Records the hero picks like src/pkjs/schedule.js would compute them, then
+// evaluates the same slots again from the schedule alone.
+typedef struct {
+    AirportSchedule schedule;
+    uint8_t name_index[AIRPORT_SCHEDULE_SLOTS_MAX];
+} SimSchedule;
+
+static void schedule_record(SimSchedule *rec, time_t start, time_t t) {
+    time_t quarter = (t - start) / SLOT_SECONDS;
+    int slot = (int)(quarter / 4) * AIRPORT_SCHEDULE_SLOTS_PER_HOUR + (int)(quarter % 4);
+    if (slot >= AIRPORT_SCHEDULE_SLOTS_MAX) return;
+    rec->schedule.slots[slot].bucket = s_selected_bucket < 0 ? AIRPORT_SCHEDULE_NONE : (uint8_t)s_selected_bucket;
+    rec->schedule.slots[slot].offset_quarters = (int8_t)s_selected_offset_quarters;
+    rec->name_index[slot] = (uint8_t)s_selected_name_index;
+    if (slot >= rec->schedule.slot_count) rec->schedule.slot_count = (uint8_t)(slot + 1);
+}
+
+// Returns the number of slots that came out differently
+static uint64_t schedule_replay(SimSchedule *rec, time_t start, long target) {
+    AirportSchedule *sched = &rec->schedule;
+    sched->version = AIRPORT_SCHEDULE_VERSION;
+    sched->target_quarters = (uint8_t)(target / SLOT_SECONDS);
+    sched->bucket_count = (uint8_t)TZ_LIST_COUNT;
+    sched->first_slot_utc = (int32_t)start;
+    size_t length = AIRPORT_SCHEDULE_HEADER_BYTES + sched->slot_count * sizeof(AirportScheduleSlot);
+
+    uint64_t mismatches = 0;
+    sched->data_checksum = AIRPORT_DATA_CHECKSUM ^ 1u;  // other data: must be refused
+    if (clock_closest_airport_noon_set_schedule((const uint8_t *)sched, length)) mismatches++;
+    sched->data_checksum = AIRPORT_DATA_CHECKSUM;
+    if (!clock_closest_airport_noon_set_schedule((const uint8_t *)sched, length)) return sched->slot_count;
+
+    int saved_strip = s_strip_count;
+    s_strip_count = 0;  // hero only: no sweep at all
+    for (int slot = 0; slot < sched->slot_count; ++slot) {
+        time_t t = start + (slot / AIRPORT_SCHEDULE_SLOTS_PER_HOUR) * 3600L +
+                   (slot % AIRPORT_SCHEDULE_SLOTS_PER_HOUR) * SLOT_SECONDS;
+        _airport_evaluate(t, target, true);
+        const AirportScheduleSlot *want = &sched->slots[slot];
+        int bucket = want->bucket == AIRPORT_SCHEDULE_NONE ? -1 : want->bucket;
+        if (s_selected_bucket != bucket || (bucket >= 0 && (s_selected_name_index != rec->name_index[slot] ||
+                                                            s_selected_offset_quarters != want->offset_quarters))) {
+            mismatches++;
+        }
+    }
+    s_strip_count = saved_strip;
+    clock_closest_airport_noon_set_schedule(NULL, 0);
+    return mismatches;
+}
+
+// --- Simulation ---
+#define GLANCE_TAP_PERIOD 3607  // seconds between simulated wrist taps
+#define SIM_NEVER         ((time_t)INT32_MAX)
+
+typedef struct {
+    FaceText *code, *name, *time, *tid, *beat;
+    time_t noon_due, tid_due, beat_due;  // next_change() deadlines, 0 = now
+    bool   footer_back;                  // a tap opened the window: check the footer
+} SimFace;
+
+static uint64_t s_wakeups;       // ticks in which any module was due
+static uint64_t s_footer_blank;  // taps after which the TID or .beat stayed blank
+
+// Mirrors watchface.c's face_detail_update for glance mode: every module is
+// due again, the footer only while the tap window is open
+static void sim_glance(SimFace *face, bool burst) {
+    clock_closest_airport_noon_set_seconds(burst);
+    face->noon_due = 0;
+    face->tid_due = face->beat_due = burst ? 0 : SIM_NEVER;
+    face->footer_back = burst;
+    if (!burst) {
+        clock_tid_hide(face->tid);
+        clock_beat_hide(face->beat);
+    }
+}
+
+// Mirrors watchface.c's scheduler_wake: only modules that are due are called
+static inline void sim_tick(SimFace *face, UtcTime *utc, time_t t, uint16_t ms,
+                            const struct tm *tick_time, long target) {
+    shim_set_time(t, ms);
+    time_t seconds;
+    uint16_t milliseconds;
+    time_ms(&seconds, &milliseconds);
+    time_math_utc_advance(utc, seconds, tick_time);
+    if (face->noon_due <= seconds || face->tid_due <= seconds || face->beat_due <= seconds) s_wakeups++;
+    if (face->noon_due <= seconds) {
+        clock_closest_airport_noon_update(face->code, face->time, utc, target);
+        face_text_set_text(face->name, s_selected_name);
+        face->noon_due = clock_closest_airport_noon_next_change(utc);
+    }
+    if (face->tid_due <= seconds) {
+        clock_tid_update(face->tid, seconds, milliseconds);
+        face->tid_due = clock_tid_next_change(seconds);
+    }
+    if (face->beat_due <= seconds) {
+        clock_beat_update(face->beat, utc);
+        face->beat_due = clock_beat_next_change(utc);
+    }
+    if (face->footer_back) {
+        if (!face_text_get_text(face->tid)[0] || !face_text_get_text(face->beat)[0]) s_footer_blank++;
+        face->footer_back = false;
+    }
+}
+
+static int run(SimFace *face, int year, int days, long target, bool check, int glance) {
+    time_t start = year_start(year);
+    time_t end = start + (time_t)days * 86400;
+    UtcTime utc = UTC_TIME_INIT;
+
+    // Fresh start for every run, like a relaunch with no persisted pick
+    s_last_update_time = -1;
+    s_last_re_eval_time = -1;
+    face->noon_due = face->tid_due = face->beat_due = 0;
+    if (glance) sim_glance(face, false);
+    s_set_text_calls = s_set_text_changes = 0;
+    s_wakeups = s_code_offslot = s_footer_blank = 0;
+    uint32_t dirty_start = shim_dirty_count();
+    persist_delete(HISTORY_SIM_KEY);
+    selection_history_load(HISTORY_SIM_KEY, start);
+    uint32_t writes_start = shim_persist_writes();
+    uint64_t history_mismatches = 0;
+
+    uint64_t plain_ns = 0, eval_ns = 0;
+    uint64_t plain_ticks = 0, eval_ticks = 0;
+    uint64_t checked = 0, mismatches = 0, warm_failures = 0;
+    int reported = 0;
+    struct tm tick_tm;
+    static SimSchedule rec;
+    memset(&rec, 0, sizeof(rec));
+
+    uint64_t seg = now_ns();
+    for (time_t t = start; t < end; ++t) {
+        uint16_t ms = (uint16_t)((t * 7919) % 1000);
+        int32_t sod = time_math_utc_sod(t);
+        if (sod % 60 == 0 || t == start) gmtime_r(&t, &tick_tm);
+        else tick_tm.tm_sec = sod % 60;
+        if (glance) {
+            // Taps drift through the seconds of the minute and the slots
+            time_t since_tap = (t - start) % GLANCE_TAP_PERIOD;
+            if (since_tap == GLANCE_TAP_PERIOD / 2) sim_glance(face, true);
+            else if (since_tap == GLANCE_TAP_PERIOD / 2 + glance) sim_glance(face, false);
+        }
+        s_in_eval_slot = is_eval_slot(sod) || t == start;
+
+        if (!is_eval_slot(sod)) {
+            sim_tick(face, &utc, t, ms, &tick_tm, target);
+            plain_ticks++;
+            continue;
+        }
+
+        // Re-evaluation tick: timed on its own, then checked off the clock
+        uint64_t t0 = now_ns();
+        plain_ns += t0 - seg;
+        sim_tick(face, &utc, t, ms, &tick_tm, target);
+        uint64_t t1 = now_ns();
+        eval_ns += t1 - t0;
+        eval_ticks++;
+
+        if (check) {
+            checked++;
+            bool ok = check_pick(t, target, s_selected_bucket, s_selected_offset_quarters,
+                                 s_selected_code, &reported);
+            for (int r = 0; r < s_strip_count; ++r) {
+                ok &= check_pick(t, s_strip_target[r], s_strip_bucket[r], s_strip_offset_quarters[r],
+                                 s_strip_code[r], &reported);
+            }
+            if (!ok) mismatches++;
+        }
+        if (!check_warm_start(t, target)) warm_failures++;
+        if (!history_record(t)) history_mismatches++;
+        schedule_record(&rec, start, t);
+        seg = now_ns();
+    }
+    plain_ns += now_ns() - seg;
+    uint64_t schedule_mismatches = schedule_replay(&rec, start, target);
+    // Warm-start checks write their snapshot every slot; count the journal's only
+    uint32_t history_writes = shim_persist_writes() - writes_start - (uint32_t)eval_ticks;
+    history_mismatches += history_reload_mismatches(end);
+
+    double hours = (double)(end - start) / 3600.0;
+    uint64_t ticks = plain_ticks + eval_ticks;
+    printf("target %02ld:%02ld + %d strip rows, %d days from %d-01-01%s: %llu ticks, %llu re-evaluations\n",
+           target / 3600, (target / 60) % 60, s_strip_count, days, year, glance ? ", glance" : "",
+           (unsigned long long)ticks, (unsigned long long)eval_ticks);
+    printf("  ns/tick        %8.1f  (plain %.1f, re-eval %.1f)\n",
+           (double)(plain_ns + eval_ns) / (double)ticks,
+           plain_ticks ? (double)plain_ns / (double)plain_ticks : 0.0,
+           eval_ticks ? (double)eval_ns / (double)eval_ticks : 0.0);
+    printf("  set_text/hour  %8.1f  (changed %.1f, layer_mark_dirty %.1f)\n",
+           (double)s_set_text_calls / hours, (double)s_set_text_changes / hours,
+           (double)(shim_dirty_count() - dirty_start) / hours);
+    printf("  wakeups/hour   %8.1f\n", (double)s_wakeups / hours);
+    if (glance) {
+        printf("  glance         %8d  s after a tap every %d s, %llu code changes off the slots, "
+               "%llu blank footers after a tap\n",
+               glance, GLANCE_TAP_PERIOD, (unsigned long long)s_code_offslot, (unsigned long long)s_footer_blank);
+        sim_glance(face, true);
+    }
+    printf("  warm start     %8llu  failures\n", (unsigned long long)warm_failures);
+    printf("  schedule       %8d  slots replayed, %llu mismatches\n",
+           rec.schedule.slot_count, (unsigned long long)schedule_mismatches);
+    printf("  history        %8d  records held, %.1f persist writes/day, %d airports in the last day, %llu mismatches\n",
+           selection_history_count(), (double)history_writes * 86400.0 / (double)(end - start),
+           selection_history_seen_since(end - 86400), (unsigned long long)history_mismatches);
+    if (check) {
+        printf("  reference      %8llu  slots checked, %llu mismatches\n",
+               (unsigned long long)checked, (unsigned long long)mismatches);
+    }
+    return (int)(mismatches + warm_failures + schedule_mismatches + history_mismatches + s_code_offslot +
+                 s_footer_blank);
+}
+
+int main(int argc, char **argv) {
+    const char *reference = NULL;
+    int year = 0, days = 0, target_count = 0, strip_count = -1, glance = 0;
+    long targets[4];
+    long strip[AIRPORT_STRIP_MAX];
+
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--reference") && i + 1 < argc) reference = argv[++i];
+        else if (!strcmp(argv[i], "--year") && i + 1 < argc) year = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--days") && i + 1 < argc) days = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--glance") && i + 1 < argc) glance = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "--target") && i + 1 < argc && target_count < 4) targets[target_count++] = atol(argv[++i]);
+        else if (!strcmp(argv[i], "--strip") && i + 1 < argc && strip_count < AIRPORT_STRIP_MAX) {
+            if (strip_count < 0) strip_count = 0;
+            strip[strip_count++] = atol(argv[++i]);
+        } else {
+            fprintf(stderr, "usage: %s [--reference FILE] [--year YYYY] [--target SECONDS]... [--strip SECONDS]... [--days N] [--glance SECONDS]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (reference) {
+        if (!load_reference(reference)) return 2;
+        if (year && year != s_ref_year) {
+            fprintf(stderr, "reference is for %d, not %d\n", s_ref_year, year);
+            return 2;
+        }
+        year = s_ref_year;
+    }
+    if (!year) year = AIRPORT_TZ_FIRST_YEAR;
+    if (!days) days = (int)((year_start(year + 1) - year_start(year)) / 86400);
+    if (!target_count) {
+        targets[target_count++] = 12 * 3600L;  // MODE_NOON
+        targets[target_count++] = 17 * 3600L;  // MODE_5PM
+    }
+    if (strip_count < 0) {
+        strip_count = 0;
+        strip[strip_count++] = 9 * 3600L;
+        strip[strip_count++] = 17 * 3600L;
+        strip[strip_count++] = 0;
+    }
+    clock_closest_airport_noon_set_strip(strip, strip_count);
+
+    SimFace face;
+    face_layer_create(GRect(0, 0, 144, 168), NULL);
+    face.code = clock_closest_airport_noon_code_init(GRect(0, 0, 144, 28));
+    face.name = face_text_create(GRect(0, 28, 144, 28), "", FONT_KEY_GOTHIC_18);
+    face.time = clock_closest_airport_noon_time_init(GRect(0, 56, 144, 42));
+    face.tid  = clock_tid_init(GRect(0, 120, 144, 28));
+    face.beat = clock_beat_init(GRect(0, 148, 144, 20));
+    s_code_field = face.code;
+
+    int failures = 0;
+    for (int i = 0; i < target_count; ++i) {
+        failures += run(&face, year, days, targets[i], reference != NULL, glance);
+    }
+
+    clock_beat_deinit(face.beat);
+    clock_tid_deinit(face.tid);
+    clock_closest_airport_noon_deinit(face.time);
+    face_text_destroy(face.name);
+    clock_closest_airport_noon_deinit(face.code);
+    face_layer_destroy();
+    return failures ? 1 : 0;
+}